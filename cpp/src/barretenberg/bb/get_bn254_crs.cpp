@@ -1,7 +1,56 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <array>
+#include <atomic>
+#include <cstring>
 
 namespace {
+/**
+ * @brief Decodes serialized points in place, optionally checking that they are on the curve.
+ * @details A serialized point takes exactly the 64 bytes of a g1::affine_element, so raw data can be read straight into
+ * the output buffer and each element then overwritten with its own decoding.
+ */
+void decode_bn254_g1_points(bb::g1::affine_element* points, size_t num_points, bool validate)
+{
+    static_assert(sizeof(bb::g1::affine_element) == 64);
+    std::atomic<bool> all_on_curve = true;
+    bb::run_loop_in_parallel(num_points, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            std::array<uint8_t, 64> serialized;
+            memcpy(serialized.data(), &points[i], serialized.size());
+            points[i] = from_buffer<bb::g1::affine_element>(serialized);
+            if (validate && !points[i].on_curve()) {
+                all_on_curve = false;
+            }
+        }
+    });
+    if (!all_on_curve) {
+        throw std::runtime_error("Invalid point in g1 data.");
+    }
+}
+
+std::vector<bb::g1::affine_element> read_bn254_g1_data(const std::filesystem::path& path,
+                                                       size_t num_points,
+                                                       bool validate)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Unable to open file: " + path.string());
+    }
+
+    auto points = std::vector<bb::g1::affine_element>(num_points);
+    for (size_t start = 0; start < num_points; start += bb::G1_POINTS_PER_CHUNK) {
+        const size_t chunk_size = std::min(bb::G1_POINTS_PER_CHUNK, num_points - start);
+        file.read(reinterpret_cast<char*>(&points[start]), static_cast<std::streamsize>(chunk_size * 64));
+        if (!file) {
+            throw std::runtime_error("Failed to read g1 data from " + path.string());
+        }
+        decode_bn254_g1_points(&points[start], chunk_size, validate);
+    }
+    return points;
+}
+
 std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
 {
     size_t g1_end = num_points * 64 - 1;
@@ -30,7 +79,7 @@ std::vector<uint8_t> download_bn254_g2_data()
 } // namespace
 
 namespace bb {
-std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points)
+std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points, bool validate)
 {
     std::filesystem::create_directories(path);
 
@@ -39,12 +88,7 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
 
     if (g1_file_size >= num_points * 64 && g1_file_size % 64 == 0) {
         vinfo("using cached crs of size ", std::to_string(g1_file_size / 64), " at ", g1_path);
-        auto data = read_file(g1_path, g1_file_size);
-        auto points = std::vector<g1::affine_element>(num_points);
-        for (size_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<g1::affine_element>(data, i * 64);
-        }
-        return points;
+        return read_bn254_g1_data(g1_path, num_points, validate);
     }
 
     vinfo("downloading crs...");
@@ -52,9 +96,8 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
     write_file(g1_path, data);
 
     auto points = std::vector<g1::affine_element>(num_points);
-    for (size_t i = 0; i < num_points; ++i) {
-        points[i] = from_buffer<g1::affine_element>(data, i * 64);
-    }
+    memcpy(points.data(), data.data(), num_points * 64);
+    decode_bn254_g1_points(points.data(), num_points, validate);
     return points;
 }
 
@@ -9,6 +9,12 @@
 #include <ios>
 
 namespace bb {
-std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
+// Number of points read from the cached crs file per chunk, small enough for a chunk to stay in cache while decoding
+constexpr size_t G1_POINTS_PER_CHUNK = 1 << 16;
+
+// Loads num_points from the crs cached at path (downloading it if needed), optionally checking they are on the curve
+std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path,
+                                                  size_t num_points,
+                                                  bool validate = false);
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
 } // namespace bb
\ No newline at end of file
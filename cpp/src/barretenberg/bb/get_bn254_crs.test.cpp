@@ -0,0 +1,70 @@
+#include "get_bn254_crs.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace bb;
+
+// Normally defined by main.cpp, which is not part of the test binary
+bool verbose = false;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+class GetBn254CrsTest : public ::testing::Test {
+  public:
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() / ("get_bn254_crs_test_" + std::to_string(getpid()));
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    // Writes points to the cached crs file in the format get_bn254_g1_data reads
+    void write_g1_data(std::vector<g1::affine_element> const& points)
+    {
+        std::vector<uint8_t> data;
+        data.reserve(points.size() * 64);
+        for (const auto& point : points) {
+            auto buffer = to_buffer(point);
+            data.insert(data.end(), buffer.begin(), buffer.end());
+        }
+        write_file(dir / "bn254_g1.dat", data);
+    }
+
+    std::filesystem::path dir;
+};
+} // namespace
+
+TEST_F(GetBn254CrsTest, ReadsCachedPointsAcrossPartialChunks)
+{
+    // The last chunk of the file is not full, and a read of fewer points stops mid chunk
+    const size_t num_points = G1_POINTS_PER_CHUNK + 3;
+    std::vector<g1::affine_element> points(num_points);
+    std::generate(points.begin(), points.end(), [] { return g1::affine_element::random_element(&engine); });
+    write_g1_data(points);
+
+    for (size_t to_read : { num_points, G1_POINTS_PER_CHUNK + 1, size_t(5) }) {
+        auto result = get_bn254_g1_data(dir, to_read, /*validate=*/true);
+        ASSERT_EQ(result.size(), to_read);
+        EXPECT_TRUE(std::equal(result.begin(), result.end(), points.begin()));
+    }
+}
+
+TEST_F(GetBn254CrsTest, ValidateRejectsPointOffTheCurve)
+{
+    std::vector<g1::affine_element> points(16);
+    std::generate(points.begin(), points.end(), [] { return g1::affine_element::random_element(&engine); });
+    points[11].y += fq::one();
+    ASSERT_FALSE(points[11].on_curve());
+    write_g1_data(points);
+
+    // Without validation the point is decoded as is
+    EXPECT_EQ(get_bn254_g1_data(dir, points.size())[11], points[11]);
+    EXPECT_THROW(get_bn254_g1_data(dir, points.size(), /*validate=*/true), std::runtime_error);
+    // Points before the invalid one are still accepted
+    EXPECT_EQ(get_bn254_g1_data(dir, 11, /*validate=*/true).size(), 11);
+}
@@ -32,20 +32,34 @@ std::string getHomeDir()
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 bool verbose = false;
+bool use_point_table_cache = false;
 
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
 /**
  * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
+ * @details With --point_table_cache the pippenger point table is memory mapped from (and on first use written to) the
+ * CRS directory, instead of being regenerated from the g1 points by every invocation.
  *
  * @param dyadic_circuit_size power-of-2 circuit size
  */
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    const size_t num_points = dyadic_circuit_size + 1;
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
+    if (use_point_table_cache) {
+        // The g1 points are only loaded if the cached table is missing, too small, corrupted or older than them
+        srs::init_crs_factory(
+            CRS_PATH,
+            CRS_PATH + "/bn254_g1.dat",
+            num_points,
+            [&] { return get_bn254_g1_data(CRS_PATH, num_points); },
+            bn254_g2_data);
+        return;
+    }
+    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, num_points);
     srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
 }
 
@@ -541,6 +555,7 @@ int main(int argc, char* argv[])
     try {
         std::vector<std::string> args(argv + 1, argv + argc);
         verbose = flag_present(args, "-v") || flag_present(args, "--verbose");
+        use_point_table_cache = flag_present(args, "--point_table_cache");
 
         if (args.empty()) {
             std::cerr << "No command provided.\n";
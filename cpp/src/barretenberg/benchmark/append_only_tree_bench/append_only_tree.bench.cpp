@@ -1,14 +1,14 @@
 #include "barretenberg/crypto/merkle_tree/append_only_tree/append_only_tree.hpp"
-#include "barretenberg/crypto/merkle_tree/array_store.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
 using namespace bb::crypto::merkle_tree;
 
-using Pedersen = AppendOnlyTree<ArrayStore, PedersenHashPolicy>;
-using Poseidon2 = AppendOnlyTree<ArrayStore, Poseidon2HashPolicy>;
+using Pedersen = AppendOnlyTree<NodeStore, PedersenHashPolicy>;
+using Poseidon2 = AppendOnlyTree<NodeStore, Poseidon2HashPolicy>;
 
 const size_t TREE_DEPTH = 32;
 const size_t MAX_BATCH_SIZE = 128;
@@ -27,7 +27,7 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
     const size_t batch_size = size_t(state.range(0));
     const size_t depth = TREE_DEPTH;
 
-    ArrayStore store(depth, 1024 * 1024);
+    NodeStore store(depth, 1024 * 1024);
     TreeType tree = TreeType(store, depth);
 
     for (auto _ : state) {
@@ -1,15 +1,15 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_tree.hpp"
-#include "barretenberg/crypto/merkle_tree/array_store.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/leaves_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
 using namespace bb::crypto::merkle_tree;
 
-using Poseidon2 = IndexedTree<ArrayStore, LeavesCache, Poseidon2HashPolicy>;
-using Pedersen = IndexedTree<ArrayStore, LeavesCache, PedersenHashPolicy>;
+using Poseidon2 = IndexedTree<NodeStore, LeavesCache, Poseidon2HashPolicy>;
+using Pedersen = IndexedTree<NodeStore, LeavesCache, PedersenHashPolicy>;
 
 const size_t TREE_DEPTH = 32;
 const size_t MAX_BATCH_SIZE = 128;
@@ -29,7 +29,7 @@ template <typename TreeType> void multi_thread_indexed_tree_bench(State& state)
     const size_t batch_size = size_t(state.range(0));
     const size_t depth = TREE_DEPTH;
 
-    ArrayStore store(depth, 1024 * 1024);
+    NodeStore store(depth, 1024 * 1024);
     TreeType tree = TreeType(store, depth, batch_size);
 
     for (auto _ : state) {
@@ -48,7 +48,7 @@ template <typename TreeType> void single_thread_indexed_tree_bench(State& state)
     const size_t batch_size = size_t(state.range(0));
     const size_t depth = TREE_DEPTH;
 
-    ArrayStore store(depth, 1024 * 1024);
+    NodeStore store(depth, 1024 * 1024);
     TreeType tree = TreeType(store, depth, batch_size);
 
     for (auto _ : state) {
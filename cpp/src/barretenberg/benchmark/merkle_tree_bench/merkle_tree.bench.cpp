@@ -1,6 +1,7 @@
 #include "barretenberg/crypto/merkle_tree/merkle_tree.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
 #include "barretenberg/crypto/merkle_tree/memory_store.hpp"
+#include "barretenberg/crypto/merkle_tree/memory_tree.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
 
@@ -73,4 +74,25 @@ void update_random_elements(State& state) noexcept
 }
 BENCHMARK(update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(1);
 
+/**
+ * @brief Builds a full tree from its leaves, sweeping the depth (range 0) and the number of threads hashing the lower
+ * layers (range 1)
+ */
+void build_tree_from_leaves(State& state) noexcept
+{
+    const auto depth = static_cast<size_t>(state.range(0));
+    const auto num_threads = static_cast<size_t>(state.range(1));
+    std::vector<fr> leaves(1UL << depth);
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        leaves[i] = fr(i);
+    }
+    for (auto _ : state) {
+        MemoryTree<PedersenHashPolicy> tree(depth, leaves, num_threads);
+        DoNotOptimize(tree.root());
+    }
+}
+BENCHMARK(build_tree_from_leaves)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 10, 12, 14, 16 }, { 1, 2, 4, 8, 16 } });
+
 BENCHMARK_MAIN();
@@ -102,6 +102,36 @@ TEST(ultra_circuit_constructor, create_gates_from_plookup_accumulators)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_circuit_constructor, lookup_tables_are_shared)
+{
+    const auto add_lookup = [](UltraCircuitBuilder& builder, const uint64_t left, const uint64_t right) {
+        const auto left_idx = builder.add_variable(fr(left));
+        const auto right_idx = builder.add_variable(fr(right));
+        const auto accumulators = plookup::get_lookup_accumulators(MultiTableId::UINT32_XOR, left, right, true);
+        builder.create_gates_from_plookup_accumulators(MultiTableId::UINT32_XOR, accumulators, left_idx, right_idx);
+    };
+
+    UltraCircuitBuilder first_builder;
+    UltraCircuitBuilder second_builder;
+    add_lookup(first_builder, 0x12345678, 0x9abcdef0);
+    add_lookup(first_builder, 0x0f0f0f0f, 0xffff0000);
+    add_lookup(second_builder, 0xdeadbeef, 0x01234567);
+
+    // Both circuits use the same tables, which are generated once
+    ASSERT_EQ(first_builder.lookup_tables.size(), second_builder.lookup_tables.size());
+    for (size_t i = 0; i < first_builder.lookup_tables.size(); ++i) {
+        const auto& first_table = first_builder.lookup_tables[i];
+        const auto& second_table = second_builder.lookup_tables[i];
+        EXPECT_EQ(first_table.data, second_table.data);
+        EXPECT_EQ(first_table.data, plookup::get_basic_table(first_table.data->id));
+        EXPECT_EQ(first_table.table_index, i);
+        EXPECT_EQ(first_table.lookup_gates.size(), 2 * second_table.lookup_gates.size());
+    }
+
+    EXPECT_TRUE(CircuitChecker::check(first_builder));
+    EXPECT_TRUE(CircuitChecker::check(second_builder));
+}
+
 TEST(ultra_circuit_constructor, base_case)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -25,8 +25,9 @@ template <typename Builder> bool UltraCircuitChecker::check(const Builder& build
     LookupHashTable lookup_hash_table;
     for (const auto& table : builder.lookup_tables) {
         const FF table_index(table.table_index);
-        for (size_t i = 0; i < table.size; ++i) {
-            lookup_hash_table.insert({ table.column_1[i], table.column_2[i], table.column_3[i], table_index });
+        const auto& data = *table.data;
+        for (size_t i = 0; i < data.size; ++i) {
+            lookup_hash_table.insert({ data.column_1[i], data.column_2[i], data.column_3[i], table_index });
         }
     }
 
@@ -16,9 +16,11 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -36,7 +38,6 @@ template <class Curve> class CommitmentKey {
     using Commitment = typename Curve::AffineElement;
 
   public:
-    scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
 
@@ -50,30 +51,99 @@ template <class Curve> class CommitmentKey {
      *
      */
     CommitmentKey(const size_t num_points)
-        : pippenger_runtime_state(num_points)
-        , crs_factory(srs::get_crs_factory<Curve>())
+        : crs_factory(srs::get_crs_factory<Curve>())
         , srs(crs_factory->get_prover_crs(num_points))
     {}
 
     // Note: This constructor is to be used only by Plonk; For Honk the srs lives in the CommitmentKey
-    CommitmentKey(const size_t num_points, std::shared_ptr<srs::factories::ProverCrs<Curve>> prover_crs)
-        : pippenger_runtime_state(num_points)
-        , srs(prover_crs)
+    CommitmentKey(const size_t /*num_points*/, std::shared_ptr<srs::factories::ProverCrs<Curve>> prover_crs)
+        : srs(prover_crs)
     {}
 
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
+     * @details The pippenger scratch space is borrowed from the process-wide pool for the duration of the MSM, see
+     * `get_pippenger_runtime_state`, so commitments may be computed concurrently.
+     *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
      */
     Commitment commit(std::span<const Fr> polynomial)
+    {
+        auto state = scalar_multiplication::get_pippenger_runtime_state<Curve>(polynomial.size());
+        return commit(polynomial, *state);
+    };
+
+    /**
+     * @brief Uses the ProverSRS to create a commitment to p(X), using the given pippenger scratch space
+     *
+     * @details Structured polynomials, with many zero or small coefficients, are committed to by a sparse MSM.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @param state pippenger scratch space for at least polynomial.size() points, not in use by any other thread
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit(std::span<const Fr> polynomial, scalar_multiplication::pippenger_runtime_state<Curve>& state)
     {
         BB_OP_COUNT_TIME();
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
+        if (scalar_multiplication::has_many_small_scalars<Curve>(polynomial.data(), degree)) {
+            return scalar_multiplication::pippenger_unsafe_sparse<Curve>(
+                const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, state);
+        }
         return scalar_multiplication::pippenger_unsafe<Curve>(
-            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, state);
+    };
+
+    /**
+     * @brief Uses the ProverSRS to create commitments to several polynomials at once
+     *
+     * @details Polynomials of equal size are committed to by a single batched MSM, which runs the wnaf computation
+     * and bucket sort of all of them in shared parallel passes; see `pippenger_unsafe_batch`. Structured
+     * polynomials are committed to one at a time by a sparse MSM instead.
+     *
+     * @param polynomials univariate polynomials pᵢ(X)
+     * @return The commitments [pᵢ(x)], in the order of the polynomials
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        std::vector<Commitment> commitments(polynomials.size());
+
+        // Group the dense polynomials by size, keeping the order of their first appearance
+        std::vector<size_t> sizes;
+        std::vector<std::vector<size_t>> groups;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            const size_t degree = polynomials[i].size();
+            ASSERT(degree <= srs->get_monomial_size());
+            if (scalar_multiplication::has_many_small_scalars<Curve>(polynomials[i].data(), degree)) {
+                commitments[i] = commit(polynomials[i]);
+                continue;
+            }
+            auto it = std::find(sizes.begin(), sizes.end(), degree);
+            if (it == sizes.end()) {
+                sizes.push_back(degree);
+                groups.emplace_back();
+                it = sizes.end() - 1;
+            }
+            groups[static_cast<size_t>(it - sizes.begin())].push_back(i);
+        }
+
+        for (size_t group_idx = 0; group_idx < groups.size(); ++group_idx) {
+            std::vector<Fr*> scalars;
+            for (size_t i : groups[group_idx]) {
+                scalars.push_back(const_cast<Fr*>(polynomials[i].data()));
+            }
+            auto state = scalar_multiplication::get_pippenger_runtime_state<Curve>(sizes[group_idx]);
+            auto results = scalar_multiplication::pippenger_unsafe_batch<Curve>(
+                scalars, srs->get_monomial_points(), sizes[group_idx], *state);
+            for (size_t j = 0; j < results.size(); ++j) {
+                commitments[groups[group_idx][j]] = results[j];
+            }
+        }
+        return commitments;
     };
 };
 
@@ -94,7 +94,7 @@ template <typename Curve> class IPA {
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
      *
      * @tparam Transcript Transcript type. Useful for testing
-     * @param ck The commitment key containing srs and pippenger_runtime_state for computing MSM
+     * @param ck The commitment key containing the srs for computing MSMs
      * @param opening_pair (challenge, evaluation)
      * @param polynomial The witness polynomial whose opening proof needs to be computed
      * @param transcript Prover transcript
@@ -196,6 +196,13 @@ template <typename Curve> class IPA {
         // Iterate for log(poly_degree) rounds to compute the round commitments.
         auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_length));
 
+        // Pippenger reads its points from a table that also holds the endomorphism image of every point. In the first
+        // round the SRS is such a table already. Afterwards the folded G_vec_local is expanded into G_table once per
+        // round, which both L_i and R_i read from, rather than each MSM allocating and generating a table of its own.
+        std::vector<Commitment> G_table(poly_length);
+        Commitment* G_table_points = srs_elements;
+        auto pippenger_runtime_state = bb::scalar_multiplication::get_pippenger_runtime_state<Curve>(poly_length / 2);
+
         // Allocate space for L_i and R_i elements
         GroupElement L_i;
         GroupElement R_i;
@@ -244,16 +251,33 @@ template <typename Curve> class IPA {
                 /*finite_field_additions_per_iteration=*/2,
                 /*finite_field_multiplications_per_iteration=*/2);
 
+            if (i > 0) {
+                run_loop_in_parallel_if_effective(
+                    round_size * 2,
+                    [&G_vec_local, &G_table](size_t start, size_t end) {
+                        bb::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                            &G_vec_local[start], &G_table[start * 2], end - start);
+                    },
+                    /*finite_field_additions_per_iteration=*/1,
+                    /*finite_field_multiplications_per_iteration=*/1,
+                    /*finite_field_inversions_per_iteration=*/0,
+                    /*group_element_additions_per_iteration=*/0,
+                    /*group_element_doublings_per_iteration=*/0,
+                    /*scalar_multiplications_per_iteration=*/0,
+                    /*sequential_copy_ops_per_iteration=*/2);
+                G_table_points = G_table.data();
+            }
+
             // Step 6.a (using letters, because doxygen automaticall converts the sublist counters to letters :( )
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
+            L_i = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+                &a_vec[0], G_table_points + round_size * 2, round_size, *pippenger_runtime_state);
             L_i += aux_generator * inner_prod_L;
 
             // Step 6.b
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
+            R_i = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+                &a_vec[round_size], G_table_points, round_size, *pippenger_runtime_state);
             R_i += aux_generator * inner_prod_R;
 
             // Step 6.c
@@ -308,7 +332,7 @@ template <typename Curve> class IPA {
      * @brief Verify the correctness of a Proof
      *
      * @tparam Transcript Allows to specify a transcript class. Useful for testing
-     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param vk Verification_key containing the srs to be used for MSMs
      * @param opening_claim Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$
      * @param transcript Transcript with elements from the prover and generated challenges
      *
@@ -383,8 +407,9 @@ template <typename Curve> class IPA {
 
         // Step 5.
         // Compute C₀ = C' + ∑_{j ∈ [k]} u_j^{-1}L_j + ∑_{j ∈ [k]} u_jR_j
+        auto pippenger_runtime_state = bb::scalar_multiplication::get_pippenger_runtime_state<Curve>(poly_length);
         GroupElement LR_sums = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &msm_scalars[0], &msm_elements[0], pippenger_size, vk->pippenger_runtime_state);
+            &msm_scalars[0], &msm_elements[0], pippenger_size, *pippenger_runtime_state);
         GroupElement C_zero = C_prime + LR_sums;
 
         //  Step 6.
@@ -423,33 +448,14 @@ template <typename Curve> class IPA {
             /*finite_field_additions_per_iteration=*/0,
             /*finite_field_multiplications_per_iteration=*/log_poly_degree);
 
+        // The SRS stored in the verification key is the result after applying the pippenger point table, so it can be
+        // passed to pippenger as is.
         auto* srs_elements = vk->srs->get_monomial_points();
 
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_length);
-
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        run_loop_in_parallel_if_effective(
-            poly_length,
-            [&G_vec_local, srs_elements](size_t start, size_t end) {
-                for (size_t i = start * 2; i < end * 2; i += 2) {
-                    G_vec_local[i >> 1] = srs_elements[i];
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/0,
-            /*finite_field_inversions_per_iteration=*/0,
-            /*group_element_additions_per_iteration=*/0,
-            /*group_element_doublings_per_iteration=*/0,
-            /*scalar_multiplications_per_iteration=*/0,
-            /*sequential_copy_ops_per_iteration=*/1);
-
         // Step 8.
         // Compute G₀
-        auto G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_length, vk->pippenger_runtime_state);
+        auto G_zero = bb::scalar_multiplication::pippenger<Curve>(
+            &s_vec[0], srs_elements, poly_length, *pippenger_runtime_state, /*handle_edge_cases=*/false);
 
         // Step 9.
         // Receive a₀ from the prover
@@ -468,7 +474,7 @@ template <typename Curve> class IPA {
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
      *
-     * @param ck The commitment key containing srs and pippenger_runtime_state for computing MSM
+     * @param ck The commitment key containing the srs for computing MSMs
      * @param opening_pair (challenge, evaluation)
      * @param polynomial The witness polynomial whose opening proof needs to be computed
      * @param transcript Prover transcript
@@ -487,7 +493,7 @@ template <typename Curve> class IPA {
     /**
      * @brief Verify the correctness of a Proof
      *
-     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param vk Verification_key containing the srs to be used for MSMs
      * @param opening_claim Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$
      * @param transcript Transcript with elements from the prover and generated challenges
      *
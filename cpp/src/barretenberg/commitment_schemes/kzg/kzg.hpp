@@ -25,7 +25,7 @@ template <typename Curve_> class KZG {
     /**
      * @brief Computes the KZG commitment to an opening proof polynomial at a single evaluation point
      *
-     * @param ck The commitment key which has a commit function, the srs and pippenger_runtime_state
+     * @param ck The commitment key which has a commit function and the srs
      * @param opening_pair OpeningPair = {r, v = p(r)}
      * @param polynomial The witness whose opening proof needs to be computed
      * @param prover_transcript Prover transcript
@@ -118,23 +118,21 @@ template <typename Curve> class ShplonkProver_ {
         // s.t. G(r) = 0
         Polynomial G(std::move(batched_quotient_Q)); // G(X) = Q(X)
 
-        // G₀ = ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
+        // G -= ∑ⱼ ρʲ ⋅ fⱼ(X) / ( r − xⱼ ), in a single pass over G, and G₀ += ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
         Fr current_nu = Fr::one();
-        Polynomial tmp(G.size());
+        std::vector<Fr> scaling_factors;
+        scaling_factors.reserve(num_opening_pairs);
         for (size_t j = 0; j < num_opening_pairs; ++j) {
             // (Cⱼ, xⱼ, vⱼ)
             const auto& [challenge, evaluation] = opening_pairs[j];
 
-            // tmp = ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            tmp = witness_polynomials[j];
-            tmp[0] -= evaluation;
             Fr scaling_factor = current_nu * inverse_vanishing_evals[j]; // = ρʲ / ( r − xⱼ )
-
-            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            G.add_scaled(tmp, -scaling_factor);
+            scaling_factors.emplace_back(-scaling_factor);
+            G[0] += scaling_factor * evaluation;
 
             current_nu *= nu_challenge;
         }
+        batch_linear_combination(witness_polynomials, scaling_factors, G);
 
         // Return opening pair (z, 0) and polynomial G(X) = Q(X) - Q_z(X)
         return { .opening_pair = { .challenge = z_challenge, .evaluation = Fr::zero() }, .witness = std::move(G) };
@@ -81,12 +81,10 @@ template <> class VerifierCommitmentKey<curve::Grumpkin> {
      * @param path is the location to the SRS file
      */
     VerifierCommitmentKey(size_t num_points, const std::shared_ptr<bb::srs::factories::CrsFactory<Curve>>& crs_factory)
-        : pippenger_runtime_state(num_points)
-        , srs(crs_factory->get_verifier_crs(num_points))
+        : srs(crs_factory->get_verifier_crs(num_points))
 
     {}
 
-    bb::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> srs;
 };
 
@@ -2,6 +2,7 @@
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -58,11 +59,15 @@ template <typename PCS> class ZeroMorphProver_ {
      *          Compute q_{n-3} of size N/(2^3) by
      *          q_{n-3}[l] = f[N/2^3 + l] - f[l]. Repeat similarly until you reach q_0.
      *
+     * In practice, the computation of q_k and the update of f are fused into a single pass over f, and the updated f
+     * overwrites its own lower half in a scratch buffer of size N/2. Each level is split among threads.
+     *
      * @param polynomial Multilinear polynomial f(X_0, ..., X_{d-1})
      * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
      * @return std::vector<Polynomial> The quotients q_k
      */
-    static std::vector<Polynomial> compute_multilinear_quotients(Polynomial polynomial, std::span<const FF> u_challenge)
+    static std::vector<Polynomial> compute_multilinear_quotients(const Polynomial& polynomial,
+                                                                 std::span<const FF> u_challenge)
     {
         size_t log_N = numeric::get_msb(polynomial.size());
         // The size of the multilinear challenge must equal the log of the polynomial size
@@ -70,41 +75,41 @@ template <typename PCS> class ZeroMorphProver_ {
 
         // Define the vector of quotients q_k, k = 0, ..., log_N-1
         std::vector<Polynomial> quotients;
+        quotients.reserve(log_N);
         for (size_t k = 0; k < log_N; ++k) {
             size_t size = 1 << k;
             quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
         }
-
-        // Compute the coefficients of q_{n-1}
-        size_t size_q = 1 << (log_N - 1);
-        Polynomial q{ size_q };
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
+        if (log_N == 0) {
+            return quotients;
         }
 
-        quotients[log_N - 1] = q.share();
-
-        std::vector<FF> f_k;
-        f_k.resize(size_q);
-
-        std::vector<FF> g(polynomial.data().get(), polynomial.data().get() + size_q);
-
-        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
-        for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
-            }
-
-            size_q = size_q / 2;
-            q = Polynomial{ size_q };
-
-            for (size_t l = 0; l < size_q; ++l) {
-                q[l] = f_k[size_q + l] - f_k[l];
-            }
-
-            quotients[log_N - k - 1] = q.share();
-            g = f_k;
+        // Scratch space for the updated f, which has size at most N/2
+        Polynomial f_k(static_cast<size_t>(1) << (log_N - 1), DontZeroMemory::FLAG);
+
+        // Compute q_k in reverse order from k = n-1, i.e. q_{n-1}, ..., q_0. The first level reads f from the input,
+        // every subsequent level reads it from the scratch space.
+        for (size_t k = log_N; k-- > 0;) {
+            const size_t size_q = static_cast<size_t>(1) << k;
+            const FF* f = (k == log_N - 1) ? polynomial.begin() : f_k.begin();
+            FF* f_next = f_k.begin();
+            FF* q = quotients[k].begin();
+            const FF& u = u_challenge[k];
+            // The updated f is not needed after q_0 has been computed
+            const bool update_f = k > 0;
+
+            // Index l only reads f[l] and f[size_q + l] and only writes f_next[l], so the update may be done in place
+            run_loop_in_parallel(
+                size_q,
+                [&](size_t start, size_t end) {
+                    for (size_t l = start; l < end; ++l) {
+                        q[l] = f[size_q + l] - f[l];
+                        if (update_f) {
+                            f_next[l] = f[l] + u * q[l];
+                        }
+                    }
+                },
+                /*no_multhreading_if_less_or_equal=*/1 << 10);
         }
 
         return quotients;
@@ -170,16 +175,19 @@ template <typename PCS> class ZeroMorphProver_ {
         // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
         auto result = batched_quotient;
 
+        std::vector<FF> scalars;
+        scalars.reserve(log_N);
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
             // Accumulate y^k * x^{N - d_k - 1} * q_k into \hat{q}
             auto deg_k = static_cast<size_t>((1 << k) - 1);
             auto x_power = x_challenge.pow(N - deg_k - 1); // x^{N - d_k - 1}
 
-            result.add_scaled(quotients[k], -y_power * x_power);
+            scalars.emplace_back(-y_power * x_power);
 
             y_power *= y_challenge; // update batching scalar y^k
         }
+        batch_linear_combination(quotients, scalars, result);
 
         return result;
     }
@@ -226,6 +234,8 @@ template <typename PCS> class ZeroMorphProver_ {
         result[0] -= v_evaluation * x_challenge * phi_n_x;
 
         // Add contribution from q_k polynomials
+        std::vector<FF> scalars;
+        scalars.reserve(log_N);
         auto x_power = x_challenge; // x^{2^k}
         for (size_t k = 0; k < log_N; ++k) {
             x_power = x_challenge.pow(1 << k); // x^{2^k}
@@ -242,8 +252,9 @@ template <typename PCS> class ZeroMorphProver_ {
             scalar *= x_challenge;
             scalar *= FF(-1);
 
-            result.add_scaled(quotients[k], scalar);
+            scalars.emplace_back(scalar);
         }
+        batch_linear_combination(quotients, scalars, result);
 
         // If necessary, add to Z_x the contribution related to concatenated polynomials:
         // \sum_{i=0}^{num_chunks_per_group}(x^{i * min_n + 1}concatenation_groups_batched_{i}).
@@ -253,11 +264,14 @@ template <typename PCS> class ZeroMorphProver_ {
             size_t MINICIRCUIT_N = N / concatenation_groups_batched.size();
             auto x_to_minicircuit_N =
                 x_challenge.pow(MINICIRCUIT_N); // power of x used to shift polynomials to the right
+            std::vector<FF> shifts;
+            shifts.reserve(concatenation_groups_batched.size());
             auto running_shift = x_challenge;
             for (size_t i = 0; i < concatenation_groups_batched.size(); i++) {
-                result.add_scaled(concatenation_groups_batched[i], running_shift);
+                shifts.emplace_back(running_shift);
                 running_shift *= x_to_minicircuit_N;
             }
+            batch_linear_combination(concatenation_groups_batched, shifts, result);
         }
 
         return result;
@@ -343,21 +357,28 @@ template <typename PCS> class ZeroMorphProver_ {
         // Note: g_batched is formed from the to-be-shifted polynomials, but the batched evaluation incorporates the
         // evaluations produced by sumcheck of h_i = g_i_shifted.
         FF batched_evaluation{ 0 };
-        Polynomial f_batched(N); // batched unshifted polynomials
         FF batching_scalar{ 1 };
-        for (auto [f_poly, f_eval] : zip_view(f_polynomials, f_evaluations)) {
-            f_batched.add_scaled(f_poly, batching_scalar);
+        std::vector<FF> f_batching_scalars;
+        f_batching_scalars.reserve(f_evaluations.size());
+        for (auto& f_eval : f_evaluations) {
+            f_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * f_eval;
             batching_scalar *= rho;
         }
 
-        Polynomial g_batched{ N }; // batched to-be-shifted polynomials
-        for (auto [g_poly, g_shift_eval] : zip_view(g_polynomials, g_shift_evaluations)) {
-            g_batched.add_scaled(g_poly, batching_scalar);
+        std::vector<FF> g_batching_scalars;
+        g_batching_scalars.reserve(g_shift_evaluations.size());
+        for (auto& g_shift_eval : g_shift_evaluations) {
+            g_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * g_shift_eval;
             batching_scalar *= rho;
         };
 
+        Polynomial f_batched(N); // batched unshifted polynomials
+        batch_linear_combination(f_polynomials, f_batching_scalars, f_batched);
+        Polynomial g_batched(N); // batched to-be-shifted polynomials
+        batch_linear_combination(g_polynomials, g_batching_scalars, g_batched);
+
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
         // Concatenated polynomials
@@ -369,15 +390,24 @@ template <typename PCS> class ZeroMorphProver_ {
             concatenation_groups_batched.push_back(Polynomial(N));
         }
         // for each group
+        std::vector<FF> concatenation_batching_scalars;
+        concatenation_batching_scalars.reserve(num_groups);
         for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
-            // for each element in a group
-            for (size_t j = 0; j < num_chunks_per_group; ++j) {
-                concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
-            }
+            concatenation_batching_scalars.emplace_back(batching_scalar);
             batched_evaluation += batching_scalar * concatenated_evaluations[i];
             batching_scalar *= rho;
         }
+        batch_linear_combination(concatenated_polynomials, concatenation_batching_scalars, concatenated_batched);
+        // for each element in a group
+        for (size_t j = 0; j < num_chunks_per_group; ++j) {
+            std::vector<Polynomial*> chunks;
+            chunks.reserve(num_groups);
+            for (size_t i = 0; i < num_groups; ++i) {
+                chunks.emplace_back(&concatenation_groups[i][j]);
+            }
+            batch_linear_combination(
+                RefVector<Polynomial>(chunks), concatenation_batching_scalars, concatenation_groups_batched[j]);
+        }
 
         // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
         // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
@@ -319,6 +319,54 @@ TYPED_TEST(ZeroMorphTest, QuotientConstruction)
     EXPECT_EQ(result, 0);
 }
 
+/**
+ * @brief Test method for computing q_k given multilinear f, for a size whose quotients are computed in parallel
+ *
+ */
+TYPED_TEST(ZeroMorphTest, QuotientConstructionMultithreaded)
+{
+    // Define some useful type aliases
+    using ZeroMorphProver = ZeroMorphProver_<TypeParam>;
+    using Curve = typename TypeParam::Curve;
+    using Fr = typename Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    // Use a size large enough for the computation to be split among threads
+    size_t N = 1 << 12;
+    size_t log_N = numeric::get_msb(N);
+
+    // Construct a random multilinear polynomial f, and (u,v) such that f(u) = v.
+    Polynomial multilinear_f = this->random_polynomial(N);
+    std::vector<Fr> u_challenge = this->random_evaluation_point(log_N);
+    Fr v_evaluation = multilinear_f.evaluate_mle(u_challenge);
+
+    // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
+    std::vector<Polynomial> quotients = ZeroMorphProver::compute_multilinear_quotients(multilinear_f, u_challenge);
+
+    // Show that the q_k were properly constructed by showing that the identity holds at a random multilinear challenge
+    // z, i.e. f(z) - v - \sum_{k=0}^{d-1} (z_k - u_k)q_k(z) = 0
+    std::vector<Fr> z_challenge = this->random_evaluation_point(log_N);
+
+    Fr result = multilinear_f.evaluate_mle(z_challenge);
+    result -= v_evaluation;
+    for (size_t k = 0; k < log_N; ++k) {
+        auto q_k_eval = Fr(0);
+        if (k == 0) {
+            // q_0 = a_0 is a constant polynomial so it's evaluation is simply its constant coefficient
+            q_k_eval = quotients[k][0];
+        } else {
+            // Construct (u_0, ..., u_{k-1})
+            auto subrange_size = static_cast<std::ptrdiff_t>(k);
+            std::vector<Fr> z_partial(z_challenge.begin(), z_challenge.begin() + subrange_size);
+            q_k_eval = quotients[k].evaluate_mle(z_partial);
+        }
+        // result = result - (z_k - u_k) * q_k(u_0, ..., u_{k-1})
+        result -= (z_challenge[k] - u_challenge[k]) * q_k_eval;
+    }
+
+    EXPECT_EQ(result, 0);
+}
+
 /**
  * @brief Test function for constructing batched lifted degree quotient \hat{q}
  *
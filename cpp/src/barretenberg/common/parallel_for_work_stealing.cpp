@@ -0,0 +1,279 @@
+#include "log.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+/**
+ * The shared state of one parallel_for call. Lives on the stack of the calling thread, which does not return until
+ * the thread completing the last iteration has set done under the mutex.
+ */
+struct Loop {
+    Loop(const std::function<void(size_t)>& func, size_t grain_size, size_t num_iterations)
+        : func(&func)
+        , grain_size(grain_size)
+        , iterations_remaining(num_iterations)
+    {}
+
+    const std::function<void(size_t)>* func;
+    size_t grain_size;
+    std::atomic<size_t> iterations_remaining;
+    // Ranges of this loop sitting in some queue, only modified under the lock of that queue
+    std::atomic<size_t> num_queued_tasks = 0;
+    std::atomic<bool> waiting = false;
+    bool done = false;
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+// A contiguous range of iterations of a loop.
+struct Task {
+    Loop* loop;
+    size_t begin;
+    size_t end;
+};
+
+struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+class ThreadPool {
+  public:
+    ThreadPool(size_t num_threads);
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) = delete;
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func)
+    {
+        // Splitting below ~8 tasks per thread gives diminishing load balancing returns for a lot of queue traffic.
+        const size_t num_threads = workers.size() + 1;
+        Loop loop(func, std::max<size_t>(1, num_iterations / (8 * num_threads)), num_iterations);
+
+        // Run the loop as a task of the calling thread, so its halves are pushed to the caller's queue. When called
+        // from inside another parallel_for (nested parallelism) that is a worker queue and the idle workers steal from
+        // it; no extra threads are ever created.
+        execute({ &loop, 0, num_iterations });
+
+        // Help with the ranges of this loop that nobody has taken yet, and otherwise sleep until either a thread
+        // running part of the loop publishes more of it or the loop completes. Tasks of other loops are left alone:
+        // running them here would delay this loop, and could deadlock if the caller holds a lock around it.
+        while (true) {
+            if (auto task = find_loop_task(loop)) {
+                execute(*task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(loop.mutex);
+            loop.waiting.store(true);
+            loop.condition.wait(lock, [&loop] { return loop.done || loop.num_queued_tasks.load() != 0; });
+            loop.waiting.store(false);
+            if (loop.done) {
+                return;
+            }
+        }
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    // One queue per worker, followed by a queue shared by all threads that are not part of the pool.
+    std::vector<WorkQueue> queues;
+    std::atomic<size_t> num_pending_tasks = 0;
+    std::atomic<size_t> num_sleeping = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable condition;
+    bool stop = false;
+
+    static thread_local WorkQueue* local_queue;
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+
+    WorkQueue& get_local_queue() { return local_queue != nullptr ? *local_queue : queues.back(); }
+
+    void push(Task task)
+    {
+        // Counted before being published, so that the count never drops below the number of queued tasks
+        num_pending_tasks.fetch_add(1);
+        {
+            WorkQueue& queue = get_local_queue();
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(task);
+            task.loop->num_queued_tasks.fetch_add(1);
+        }
+        // The caller of the loop sets waiting before re-checking num_queued_tasks under the loop's lock, so either it
+        // sees this task or we see it waiting and wake it. The loop is alive, as we are running part of it.
+        if (task.loop->waiting.load()) {
+            { std::unique_lock<std::mutex> lock(task.loop->mutex); }
+            task.loop->condition.notify_one();
+        }
+        // A worker increments num_sleeping before re-checking num_pending_tasks under the lock, so either it sees
+        // this task or we see it sleeping and wake it.
+        if (num_sleeping.load() != 0) {
+            { std::unique_lock<std::mutex> lock(sleep_mutex); }
+            condition.notify_one();
+        }
+    }
+
+    // Removes a task from a queue whose lock is held
+    Task take(WorkQueue& queue, std::deque<Task>::iterator it)
+    {
+        Task task = *it;
+        queue.tasks.erase(it);
+        task.loop->num_queued_tasks.fetch_sub(1);
+        num_pending_tasks.fetch_sub(1);
+        return task;
+    }
+
+    /**
+     * Pops the newest task of the local queue, or failing that steals the oldest (i.e. largest) task of another queue.
+     */
+    std::optional<Task> find_task()
+    {
+        if (num_pending_tasks.load() == 0) {
+            return std::nullopt;
+        }
+        WorkQueue& own = get_local_queue();
+        {
+            std::unique_lock<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                return take(own, std::prev(own.tasks.end()));
+            }
+        }
+        const size_t own_index = static_cast<size_t>(&own - queues.data());
+        for (size_t i = 1; i < queues.size(); ++i) {
+            WorkQueue& victim = queues[(own_index + i) % queues.size()];
+            std::unique_lock<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                return take(victim, victim.tasks.begin());
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * As find_task, but only returns tasks of the given loop. Queues hold a handful of ranges per active loop, so
+     * scanning them is cheap.
+     */
+    std::optional<Task> find_loop_task(Loop& loop)
+    {
+        if (loop.num_queued_tasks.load() == 0) {
+            return std::nullopt;
+        }
+        auto belongs_to_loop = [&loop](const Task& task) { return task.loop == &loop; };
+        WorkQueue& own = get_local_queue();
+        {
+            std::unique_lock<std::mutex> lock(own.mutex);
+            auto it = std::find_if(own.tasks.rbegin(), own.tasks.rend(), belongs_to_loop);
+            if (it != own.tasks.rend()) {
+                return take(own, std::prev(it.base()));
+            }
+        }
+        const size_t own_index = static_cast<size_t>(&own - queues.data());
+        for (size_t i = 1; i < queues.size(); ++i) {
+            WorkQueue& victim = queues[(own_index + i) % queues.size()];
+            std::unique_lock<std::mutex> lock(victim.mutex);
+            auto it = std::find_if(victim.tasks.begin(), victim.tasks.end(), belongs_to_loop);
+            if (it != victim.tasks.end()) {
+                return take(victim, it);
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Lazily splits the range in halves, publishing the upper halves for other threads to steal, and runs the rest.
+     */
+    void execute(Task task)
+    {
+        while (task.end - task.begin > task.loop->grain_size) {
+            const size_t mid = task.begin + (task.end - task.begin) / 2;
+            push({ task.loop, mid, task.end });
+            task.end = mid;
+        }
+        for (size_t i = task.begin; i < task.end; ++i) {
+            (*task.loop->func)(i);
+        }
+        const size_t count = task.end - task.begin;
+        if (task.loop->iterations_remaining.fetch_sub(count, std::memory_order_acq_rel) == count) {
+            // The caller only returns once it has seen done under the lock, so the loop outlives this block.
+            std::unique_lock<std::mutex> lock(task.loop->mutex);
+            task.loop->done = true;
+            task.loop->condition.notify_one();
+        }
+    }
+};
+
+thread_local WorkQueue* ThreadPool::local_queue = nullptr;
+
+ThreadPool::ThreadPool(size_t num_threads)
+    : queues(num_threads + 1)
+{
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&ThreadPool::worker_loop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::worker_loop(size_t thread_index)
+{
+    local_queue = &queues[thread_index];
+    while (true) {
+        if (auto task = find_task()) {
+            execute(*task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleeping.fetch_add(1);
+        condition.wait(lock, [this] { return num_pending_tasks.load() != 0 || stop; });
+        num_sleeping.fetch_sub(1);
+        if (stop) {
+            break;
+        }
+    }
+}
+} // namespace
+
+namespace bb {
+/**
+ * A work stealing strategy. Every worker owns a deque of iteration ranges. A range is repeatedly split in half, the
+ * upper half being pushed to the back of the owner's deque, until it is small enough to run. Idle workers steal from
+ * the front of other deques, i.e. the largest ranges, so work is only divided as far as load balancing requires.
+ * The calling thread works on the remaining ranges of its own loop as well, and blocks once none are left until the
+ * loop completes. A parallel_for nested inside another one therefore runs on the same fixed set of threads, neither
+ * oversubscribing the cores nor serializing, and a waiting thread never picks up unrelated work.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    static ThreadPool pool(get_num_cpus() - 1);
+
+    if (num_iterations == 0) {
+        return;
+    }
+    pool.run(num_iterations, func);
+}
+} // namespace bb
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include <algorithm>
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -34,6 +35,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the pools above hand out single iterations from one shared counter/queue, and none of them can
+ * run a parallel_for nested inside another one. "work_stealing" gives each worker its own deque of iteration ranges
+ * that idle threads steal from, and lets a thread waiting on a (possibly nested) loop execute the untaken parts of
+ * that loop meanwhile, so back-to-back and nested loops keep all cores busy. Defaulting to work_stealing.
  */
 
 namespace bb {
@@ -69,6 +75,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,8 +90,9 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
@@ -129,6 +138,26 @@ void run_loop_in_parallel(size_t num_points,
     });
 };
 
+/**
+ * @brief Run a set of independent tasks concurrently, returning once all of them have completed
+ *
+ * @details Tasks may themselves use parallel_for. With the work stealing backend the iterations of all such nested
+ * loops are shared out among the same threads, so e.g. several mid-sized MSMs overlap rather than each one in turn
+ * saturating the cores for a while and then leaving them idle during its serial phases.
+ * @param tasks The tasks, which must not depend on each other's results
+ * @param max_concurrency The maximum number of tasks running at once, e.g. to bound the scratch memory they hold. The
+ * tasks are dealt out to that many slots, each of which runs its tasks in turn.
+ */
+void parallel_invoke(const std::vector<std::function<void()>>& tasks, size_t max_concurrency)
+{
+    const size_t num_slots = std::min({ tasks.size(), get_num_cpus(), max_concurrency });
+    parallel_for(num_slots, [&](size_t slot) {
+        for (size_t i = slot; i < tasks.size(); i += num_slots) {
+            tasks[i]();
+        }
+    });
+}
+
 /**
  * @brief Split a loop into several loops running in parallel based on operations in 1 iteration
  *
@@ -4,6 +4,7 @@
 #include <barretenberg/numeric/bitop/get_msb.hpp>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <thread>
 #include <vector>
 
@@ -28,6 +29,8 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
 void run_loop_in_parallel(size_t num_points,
                           const std::function<void(size_t, size_t)>& func,
                           size_t no_multhreading_if_less_or_equal = 0);
+void parallel_invoke(const std::vector<std::function<void()>>& tasks,
+                     size_t max_concurrency = std::numeric_limits<size_t>::max());
 
 template <typename FunctionType>
     requires(std::is_same_v<FunctionType, std::function<void(size_t, size_t)>> ||
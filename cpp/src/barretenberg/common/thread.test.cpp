@@ -0,0 +1,122 @@
+#include "thread.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+using namespace bb;
+
+TEST(Thread, ParallelForRunsEveryIterationOnce)
+{
+    for (size_t num_iterations : { 0UL, 1UL, 3UL, 64UL, 1000UL, 1UL << 16 }) {
+        std::vector<std::atomic<size_t>> counts(num_iterations);
+        parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+        for (auto& count : counts) {
+            EXPECT_EQ(count, 1);
+        }
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    constexpr size_t outer = 17;
+    constexpr size_t inner = 257;
+    std::vector<std::atomic<size_t>> counts(outer * inner);
+    parallel_for(outer, [&](size_t i) {
+        parallel_for(inner, [&](size_t j) {
+            // A third level, to exercise threads helping out while waiting on their own nested loop
+            parallel_for(2, [&](size_t) { counts[i * inner + j]++; });
+        });
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 2);
+    }
+}
+
+TEST(Thread, NestedParallelForUnderLock)
+{
+    // A thread waiting on the inner loop must not pick up another outer iteration, which would block on the mutex it
+    // already holds
+    std::mutex mutex;
+    std::atomic<size_t> count = 0;
+    parallel_for(16, [&](size_t) {
+        std::unique_lock<std::mutex> lock(mutex);
+        parallel_for(64, [&](size_t) { count++; });
+    });
+    EXPECT_EQ(count, 16 * 64);
+}
+
+TEST(Thread, ConcurrentCallers)
+{
+    constexpr size_t num_callers = 4;
+    constexpr size_t num_iterations = 10000;
+    std::vector<size_t> sums(num_callers);
+    std::vector<std::thread> callers;
+    for (size_t c = 0; c < num_callers; ++c) {
+        callers.emplace_back([&, c] {
+            std::vector<size_t> values(num_iterations);
+            for (size_t round = 0; round < 10; ++round) {
+                parallel_for(num_iterations, [&](size_t i) { values[i] = i + c; });
+            }
+            sums[c] = std::accumulate(values.begin(), values.end(), 0UL);
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (size_t c = 0; c < num_callers; ++c) {
+        EXPECT_EQ(sums[c], num_iterations * (num_iterations - 1) / 2 + num_iterations * c);
+    }
+}
+
+TEST(Thread, RunLoopInParallelCoversRange)
+{
+    constexpr size_t num_points = 12345;
+    std::vector<std::atomic<size_t>> counts(num_points);
+    run_loop_in_parallel(num_points, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            counts[i]++;
+        }
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(Thread, ParallelInvokeRunsEveryTaskOnce)
+{
+    constexpr size_t num_tasks = 7;
+    std::vector<std::atomic<size_t>> counts(num_tasks);
+    std::vector<std::function<void()>> tasks;
+    for (size_t t = 0; t < num_tasks; ++t) {
+        // Each task runs a nested loop of its own, as e.g. concurrent commitments do
+        tasks.emplace_back([&, t] { parallel_for(100, [&](size_t) { counts[t]++; }); });
+    }
+    parallel_invoke(tasks);
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 100);
+    }
+}
+
+TEST(Thread, ParallelInvokeBoundsConcurrency)
+{
+    constexpr size_t num_tasks = 9;
+    constexpr size_t max_concurrency = 2;
+    std::atomic<size_t> num_running = 0;
+    std::atomic<size_t> max_running = 0;
+    std::atomic<size_t> num_completed = 0;
+    std::vector<std::function<void()>> tasks(num_tasks, [&] {
+        const size_t running = ++num_running;
+        size_t observed = max_running;
+        while (running > observed && !max_running.compare_exchange_weak(observed, running)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --num_running;
+        ++num_completed;
+    });
+    parallel_invoke(tasks, max_concurrency);
+    EXPECT_EQ(num_completed, num_tasks);
+    EXPECT_LE(max_running, max_concurrency);
+}
@@ -1,5 +1,7 @@
 #pragma once
+#include "../../../common/thread.hpp"
 #include "../hash_path.hpp"
+#include <concepts>
 
 namespace bb::crypto::merkle_tree {
 
@@ -7,6 +9,15 @@ using namespace bb;
 
 typedef uint256_t index_t;
 
+/**
+ * @brief A store that holds nodes as field elements directly, bypassing the byte serialisation of put/get
+ */
+template <typename Store>
+concept TypedNodeStore = requires(Store& store, const Store& const_store, size_t level, size_t index, fr& value) {
+    store.put_node(level, index, value);
+    { const_store.get_node(level, index, value) } -> std::same_as<bool>;
+};
+
 /**
  * @brief Implements a simple append-only merkle tree
  * Accepts template argument of the type of store backing the tree and the hashing policy
@@ -15,6 +26,12 @@ typedef uint256_t index_t;
 template <typename Store, typename HashingPolicy> class AppendOnlyTree {
   public:
     AppendOnlyTree(Store& store, size_t depth, uint8_t tree_id = 0);
+
+    /**
+     * @brief Constructs a fork of `base` backed by `store`, which must be a fork of the store backing `base`
+     * Updates to either tree are not visible to the other. A fork is committed by continuing with it in place of `base`.
+     */
+    AppendOnlyTree(Store& store, AppendOnlyTree const& base);
     AppendOnlyTree(AppendOnlyTree const& other) = delete;
     AppendOnlyTree(AppendOnlyTree&& other) = delete;
     virtual ~AppendOnlyTree();
@@ -50,6 +67,9 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
     fr_hash_path get_hash_path(const index_t& index) const;
 
   protected:
+    // Levels with at most this many nodes to hash are hashed on the calling thread
+    static constexpr size_t MIN_PARALLEL_HASHES = 64;
+
     fr get_element_or_zero(size_t level, const index_t& index) const;
 
     void write_node(size_t level, const index_t& index, const fr& value);
@@ -81,6 +101,16 @@ AppendOnlyTree<Store, HashingPolicy>::AppendOnlyTree(Store& store, size_t depth,
     root_ = current;
 }
 
+template <typename Store, typename HashingPolicy>
+AppendOnlyTree<Store, HashingPolicy>::AppendOnlyTree(Store& store, AppendOnlyTree const& base)
+    : store_(store)
+    , depth_(base.depth_)
+    , tree_id_(base.tree_id_)
+    , zero_hashes_(base.zero_hashes_)
+    , root_(base.root_)
+    , size_(base.size_)
+{}
+
 template <typename Store, typename HashingPolicy> AppendOnlyTree<Store, HashingPolicy>::~AppendOnlyTree() {}
 
 template <typename Store, typename HashingPolicy> index_t AppendOnlyTree<Store, HashingPolicy>::size() const
@@ -124,40 +154,53 @@ template <typename Store, typename HashingPolicy> fr AppendOnlyTree<Store, Hashi
 template <typename Store, typename HashingPolicy>
 fr AppendOnlyTree<Store, HashingPolicy>::add_values(const std::vector<fr>& values)
 {
-    index_t index = size();
-    size_t number_to_insert = values.size();
+    if (values.empty()) {
+        return root_;
+    }
     size_t level = depth_;
+    index_t first = size_;
+    index_t last = size_ + values.size() - 1;
     std::vector<fr> hashes = values;
 
     // Add the values at the leaf nodes of the tree
-    for (size_t i = 0; i < number_to_insert; ++i) {
-        write_node(level, index + i, hashes[i]);
+    for (size_t i = 0; i < values.size(); ++i) {
+        write_node(level, first + i, hashes[i]);
     }
 
-    // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        for (size_t i = 0; i < number_to_insert; ++i) {
-            hashes[i] = HashingPolicy::hash_pair(hashes[i * 2], hashes[i * 2 + 1]);
-            write_node(level, index + i, hashes[i]);
+    // Rehash the nodes above [first, last] one level at a time. The hashes within a level are independent, so each
+    // level is a single batch of pair hashes, split across threads once it is wide enough to be worth distributing
+    while (level > 0) {
+        const index_t parent_first = first >> 1;
+        const size_t num_parents = size_t((last >> 1) - parent_first) + 1;
+
+        // Line up the children of the parents, reading the siblings at either end of the range from the store
+        std::vector<fr> children;
+        children.reserve(2 * num_parents);
+        if (bool(first & 0x01)) {
+            children.push_back(get_element_or_zero(level, first - 1));
+        }
+        children.insert(children.end(), hashes.begin(), hashes.end());
+        if (!bool(last & 0x01)) {
+            children.push_back(get_element_or_zero(level, last + 1));
         }
-    }
 
-    // Hash from the root of the sub-tree to the root of the overall tree
-    fr new_hash = hashes[0];
-    while (level > 0) {
-        bool is_right = bool(index & 0x01);
-        fr left_hash = is_right ? get_element_or_zero(level, index - 1) : new_hash;
-        fr right_hash = is_right ? new_hash : get_element_or_zero(level, index + 1);
-        new_hash = HashingPolicy::hash_pair(left_hash, right_hash);
-        index >>= 1;
+        hashes.resize(num_parents);
+        run_loop_in_parallel(
+            num_parents,
+            [&](size_t start, size_t end) {
+                hash_pairs<HashingPolicy>(std::span<const fr>(children).subspan(2 * start, 2 * (end - start)),
+                                          std::span<fr>(hashes).subspan(start, end - start));
+                for (size_t i = start; i < end; ++i) {
+                    write_node(level - 1, parent_first + i, hashes[i]);
+                }
+            },
+            MIN_PARALLEL_HASHES);
+        first = parent_first;
+        last = last >> 1;
         --level;
-        write_node(level, index, new_hash);
     }
     size_ += values.size();
-    root_ = new_hash;
+    root_ = hashes[0];
     return root_;
 }
 
@@ -175,21 +218,31 @@ fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero(size_t level, const
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::write_node(size_t level, const index_t& index, const fr& value)
 {
-    std::vector<uint8_t> buf;
-    write(buf, value);
-    store_.put(level, size_t(index), buf);
+    if constexpr (TypedNodeStore<Store>) {
+        store_.put_node(level, size_t(index), value);
+    } else {
+        std::vector<uint8_t> buf;
+        write(buf, value);
+        store_.put(level, size_t(index), buf);
+    }
 }
 
 template <typename Store, typename HashingPolicy>
 std::pair<bool, fr> AppendOnlyTree<Store, HashingPolicy>::read_node(size_t level, const index_t& index) const
 {
-    std::vector<uint8_t> buf;
-    bool available = store_.get(level, size_t(index), buf);
-    if (!available) {
-        return std::make_pair(false, fr::zero());
+    if constexpr (TypedNodeStore<Store>) {
+        fr value;
+        bool available = store_.get_node(level, size_t(index), value);
+        return std::make_pair(available, available ? value : fr::zero());
+    } else {
+        std::vector<uint8_t> buf;
+        bool available = store_.get(level, size_t(index), buf);
+        if (!available) {
+            return std::make_pair(false, fr::zero());
+        }
+        fr value = from_buffer<fr>(buf, 0);
+        return std::make_pair(true, value);
     }
-    fr value = from_buffer<fr>(buf, 0);
-    return std::make_pair(true, value);
 }
 
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
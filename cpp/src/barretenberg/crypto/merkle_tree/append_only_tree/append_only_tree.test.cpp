@@ -1,9 +1,11 @@
 #include "append_only_tree.hpp"
 #include "../array_store.hpp"
 #include "../memory_tree.hpp"
+#include "../node_store.hpp"
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <cstdio>
 
 using namespace bb;
 using namespace bb::crypto::merkle_tree;
@@ -125,3 +127,103 @@ TEST(stdlib_append_only_tree, can_be_filled)
     EXPECT_EQ(tree.get_hash_path(0), memdb.get_hash_path(0));
     EXPECT_EQ(tree.get_hash_path(7), memdb.get_hash_path(7));
 }
+
+TEST(stdlib_append_only_tree, node_store_matches_array_store)
+{
+    constexpr size_t depth = 10;
+    ArrayStore array_store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> array_tree(array_store, depth);
+    NodeStore node_store(depth);
+    AppendOnlyTree<NodeStore, Poseidon2HashPolicy> node_tree(node_store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    EXPECT_EQ(node_tree.root(), memdb.root());
+
+    for (size_t i = 0; i < NUM_VALUES; i += 32) {
+        std::vector<fr> batch(VALUES.begin() + static_cast<std::ptrdiff_t>(i),
+                              VALUES.begin() + static_cast<std::ptrdiff_t>(i + 32));
+        for (size_t j = 0; j < batch.size(); ++j) {
+            memdb.update_element(i + j, batch[j]);
+        }
+        EXPECT_EQ(node_tree.add_values(batch), array_tree.add_values(batch));
+        EXPECT_EQ(node_tree.root(), memdb.root());
+        EXPECT_EQ(node_tree.get_hash_path(i), memdb.get_hash_path(i));
+        EXPECT_EQ(node_tree.get_hash_path(i + 31), array_tree.get_hash_path(i + 31));
+    }
+}
+
+TEST(stdlib_append_only_tree, file_backed_node_store)
+{
+    constexpr size_t depth = 10;
+    const std::string path = "append_only_tree_node_store.test.dat";
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+    {
+        NodeStore store(depth, 1024, path);
+        AppendOnlyTree<NodeStore, Poseidon2HashPolicy> tree(store, depth);
+        for (size_t i = 0; i < 100; ++i) {
+            memdb.update_element(i, VALUES[i]);
+            tree.add_value(VALUES[i]);
+        }
+        EXPECT_EQ(tree.root(), memdb.root());
+        EXPECT_EQ(tree.get_hash_path(99), memdb.get_hash_path(99));
+    }
+    std::remove(path.c_str());
+}
+
+TEST(stdlib_append_only_tree, can_add_unaligned_batches)
+{
+    constexpr size_t depth = 10;
+    NodeStore store(depth);
+    AppendOnlyTree<NodeStore, Poseidon2HashPolicy> tree(store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Batches of odd sizes straddle subtree boundaries, the large one is hashed in parallel
+    size_t index = 0;
+    for (size_t batch_size : { 1UL, 3UL, 5UL, 200UL, 7UL, 513UL }) {
+        std::vector<fr> batch(VALUES.begin() + static_cast<std::ptrdiff_t>(index),
+                              VALUES.begin() + static_cast<std::ptrdiff_t>(index + batch_size));
+        for (size_t j = 0; j < batch_size; ++j) {
+            memdb.update_element(index + j, batch[j]);
+        }
+        EXPECT_EQ(tree.add_values(batch), memdb.root());
+        index += batch_size;
+        EXPECT_EQ(tree.size(), index);
+        EXPECT_EQ(tree.get_hash_path(0), memdb.get_hash_path(0));
+        EXPECT_EQ(tree.get_hash_path(index - 1), memdb.get_hash_path(index - 1));
+    }
+}
+
+TEST(stdlib_append_only_tree, can_fork)
+{
+    constexpr size_t depth = 10;
+    NodeStore store(depth);
+    AppendOnlyTree<NodeStore, Poseidon2HashPolicy> tree(store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+    for (size_t i = 0; i < 300; ++i) {
+        memdb.update_element(i, VALUES[i]);
+    }
+    tree.add_values(std::vector<fr>(VALUES.begin(), VALUES.begin() + 300));
+
+    // Both trees append different values on top of the shared state
+    NodeStore fork_store = store.fork();
+    AppendOnlyTree<NodeStore, Poseidon2HashPolicy> fork(fork_store, tree);
+    MemoryTree<Poseidon2HashPolicy> fork_memdb = memdb;
+    for (size_t i = 300; i < 600; ++i) {
+        memdb.update_element(i, VALUES[i]);
+        fork_memdb.update_element(i, VALUES[NUM_VALUES - i]);
+    }
+    tree.add_values(std::vector<fr>(VALUES.begin() + 300, VALUES.begin() + 600));
+    std::vector<fr> fork_values;
+    for (size_t i = 300; i < 600; ++i) {
+        fork_values.push_back(VALUES[NUM_VALUES - i]);
+    }
+    fork.add_values(fork_values);
+
+    EXPECT_EQ(tree.root(), memdb.root());
+    EXPECT_EQ(fork.root(), fork_memdb.root());
+    EXPECT_EQ(fork.size(), 600);
+    for (size_t index : { 0UL, 299UL, 300UL, 599UL }) {
+        EXPECT_EQ(tree.get_hash_path(index), memdb.get_hash_path(index));
+        EXPECT_EQ(fork.get_hash_path(index), fork_memdb.get_hash_path(index));
+    }
+}
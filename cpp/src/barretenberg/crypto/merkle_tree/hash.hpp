@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
@@ -7,6 +8,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -16,6 +18,11 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    static void hash_pairs(std::span<const fr> inputs, std::span<fr> outputs)
+    {
+        crypto::pedersen_hash::hash_pairs(inputs, outputs);
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -27,9 +34,55 @@ struct Poseidon2HashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    static void hash_pairs(std::span<const fr> inputs, std::span<fr> outputs)
+    {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(inputs, outputs);
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
+/**
+ * @brief Hashes each consecutive pair of inputs into outputs, in a single batch if the hashing policy supports it
+ */
+template <typename HashingPolicy> void hash_pairs(std::span<const fr> inputs, std::span<fr> outputs)
+{
+    if constexpr (requires { HashingPolicy::hash_pairs(inputs, outputs); }) {
+        HashingPolicy::hash_pairs(inputs, outputs);
+    } else {
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            outputs[i] = HashingPolicy::hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+        }
+    }
+}
+
+// Layers with at most this many pairs to hash are hashed on the calling thread
+constexpr size_t MIN_PARALLEL_LAYER_PAIRS = 64;
+
+/**
+ * @brief Hashes each consecutive pair of `layer` into `next_layer`
+ * @details Large layers are split into one contiguous chunk per thread, each hashed in a single batch. Layers near the
+ * root are too small to be worth splitting and are hashed on the calling thread.
+ *
+ * @param num_threads The number of chunks to split large layers into
+ */
+template <typename HashingPolicy>
+void hash_layer(std::span<const fr> layer, std::span<fr> next_layer, size_t num_threads = get_num_cpus())
+{
+    const size_t num_pairs = next_layer.size();
+    ASSERT(layer.size() == 2 * num_pairs);
+    if (num_threads <= 1 || num_pairs <= MIN_PARALLEL_LAYER_PAIRS) {
+        hash_pairs<HashingPolicy>(layer, next_layer);
+        return;
+    }
+    const size_t chunk_size = (num_pairs + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t chunk) {
+        const size_t start = std::min(chunk * chunk_size, num_pairs);
+        const size_t end = std::min(start + chunk_size, num_pairs);
+        hash_pairs<HashingPolicy>(layer.subspan(2 * start, 2 * (end - start)), next_layer.subspan(start, end - start));
+    });
+}
+
 inline bb::fr hash_pair_native(bb::fr const& lhs, bb::fr const& rhs)
 {
     return crypto::pedersen_hash::hash({ lhs, rhs }); // uses lookup tables
@@ -44,9 +97,11 @@ inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
  * Computes the root of a tree with leaves given as the vector `input`.
  *
  * @param input: vector of leaf values.
+ * @param num_threads: number of threads to hash the lower layers of the tree with.
  * @returns root as field
  */
-inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
+template <typename HashingPolicy = PedersenHashPolicy>
+bb::fr compute_tree_root_native(std::vector<bb::fr> const& input, size_t num_threads = get_num_cpus())
 {
     // Check if the input vector size is a power of 2.
     ASSERT(input.size() > 0);
@@ -54,17 +109,22 @@ inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
     auto layer = input;
     while (layer.size() > 1) {
         std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
+        hash_layer<HashingPolicy>(layer, next_layer, num_threads);
         layer = std::move(next_layer);
     }
 
     return layer[0];
 }
 
-// TODO write test
-inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
+/**
+ * Computes every node of a tree with leaves given as the vector `input`, layer by layer from the leaves up.
+ *
+ * @param input: vector of leaf values.
+ * @param num_threads: number of threads to hash the lower layers of the tree with.
+ * @returns the leaves followed by each layer of nodes, ending with the root
+ */
+template <typename HashingPolicy = PedersenHashPolicy>
+std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input, size_t num_threads = get_num_cpus())
 {
     // Check if the input vector size is a power of 2.
     ASSERT(input.size() > 0);
@@ -73,10 +133,8 @@ inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
     std::vector<bb::fr> tree(input);
     while (layer.size() > 1) {
         std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
+        hash_layer<HashingPolicy>(layer, next_layer, num_threads);
+        tree.insert(tree.end(), next_layer.begin(), next_layer.end());
         layer = std::move(next_layer);
     }
 
@@ -62,3 +62,20 @@ TEST(crypto_merkle_tree_hash, compute_tree_native)
     }
     EXPECT_EQ(tree_vector.back(), mem_tree.root());
 }
+
+TEST(crypto_merkle_tree_hash, compute_tree_native_parallel)
+{
+    constexpr size_t depth = 9;
+    std::vector<fr> leaves;
+    for (size_t i = 0; i < (size_t(1) << depth); i++) {
+        leaves.push_back(fr::random_element());
+    }
+
+    // Splitting the lower layers across threads does not change the tree
+    const std::vector<fr> expected = merkle_tree::compute_tree_native<merkle_tree::Poseidon2HashPolicy>(leaves, 1);
+    for (size_t num_threads : { 2UL, 5UL, 16UL }) {
+        EXPECT_EQ(merkle_tree::compute_tree_native<merkle_tree::Poseidon2HashPolicy>(leaves, num_threads), expected);
+        EXPECT_EQ(merkle_tree::compute_tree_root_native<merkle_tree::Poseidon2HashPolicy>(leaves, num_threads),
+                  expected.back());
+    }
+}
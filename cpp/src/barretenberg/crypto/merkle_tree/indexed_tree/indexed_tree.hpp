@@ -4,57 +4,14 @@
 #include "../hash.hpp"
 #include "../hash_path.hpp"
 #include "indexed_leaf.hpp"
+#include <functional>
+#include <limits>
+#include <unordered_map>
 
 namespace bb::crypto::merkle_tree {
 
 using index_t = uint256_t;
 
-/**
- * @brief Used in parallel insertions in the the IndexedTree. Workers signal to other following workes as they move up
- * the level of the tree.
- *
- */
-class LevelSignal {
-  public:
-    LevelSignal(size_t initial_level)
-        : signal_(initial_level){};
-    ~LevelSignal() = default;
-    LevelSignal(const LevelSignal& other)
-        : signal_(other.signal_.load())
-    {}
-    LevelSignal(const LevelSignal&& other) noexcept
-        : signal_(other.signal_.load())
-    {}
-
-    /**
-     * @brief Causes the thread to wait until the required level has been signalled
-     * @param level The required level
-     *
-     */
-    void wait_for_level(size_t level)
-    {
-        size_t current_level = signal_.load();
-        while (current_level > level) {
-            signal_.wait(current_level);
-            current_level = signal_.load();
-        }
-    }
-
-    /**
-     * @brief Signals that the given level has been passed
-     * @param level The level to be signalled
-     *
-     */
-    void signal_level(size_t level)
-    {
-        signal_.store(level);
-        signal_.notify_all();
-    }
-
-  private:
-    std::atomic<size_t> signal_;
-};
-
 /**
  * @brief Implements a parallelised batch insertion indexed tree
  * Accepts template argument of the type of store backing the tree, the type of store containing the leaves and the
@@ -65,6 +22,12 @@ template <typename Store, typename LeavesStore, typename HashingPolicy>
 class IndexedTree : public AppendOnlyTree<Store, HashingPolicy> {
   public:
     IndexedTree(Store& store, size_t depth, size_t initial_size = 1, uint8_t tree_id = 0);
+
+    /**
+     * @brief Constructs a fork of `base` backed by `store`, which must be a fork of the store backing `base`
+     * The leaves are copied from `base`, so the leaves store should share its state between copies.
+     */
+    IndexedTree(Store& store, IndexedTree const& base);
     IndexedTree(IndexedTree const& other) = delete;
     IndexedTree(IndexedTree&& other) = delete;
     ~IndexedTree();
@@ -105,17 +68,18 @@ class IndexedTree : public AppendOnlyTree<Store, HashingPolicy> {
     using AppendOnlyTree<Store, HashingPolicy>::depth;
 
   private:
-    fr update_leaf_and_hash_to_root(const index_t& index, const indexed_leaf& leaf);
-    fr update_leaf_and_hash_to_root(const index_t& index,
-                                    const indexed_leaf& leaf,
-                                    LevelSignal& leader,
-                                    LevelSignal& follower,
-                                    fr_hash_path& previous_hash_path);
+    struct leaf_insertion {
+        index_t low_leaf_index;
+        indexed_leaf low_leaf;
+    };
+
+    std::vector<fr_hash_path> update_low_leaves(const std::vector<leaf_insertion>& insertions, bool no_multithreading);
     fr append_subtree(const index_t& start_index);
 
     using AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero;
     using AppendOnlyTree<Store, HashingPolicy>::write_node;
     using AppendOnlyTree<Store, HashingPolicy>::read_node;
+    using AppendOnlyTree<Store, HashingPolicy>::MIN_PARALLEL_HASHES;
 
   private:
     using AppendOnlyTree<Store, HashingPolicy>::store_;
@@ -159,6 +123,12 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
     append_subtree(0);
 }
 
+template <typename Store, typename LeavesStore, typename HashingPolicy>
+IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store, IndexedTree const& base)
+    : AppendOnlyTree<Store, HashingPolicy>(store, base)
+    , leaves_(base.leaves_)
+{}
+
 template <typename Store, typename LeavesStore, typename HashingPolicy>
 IndexedTree<Store, LeavesStore, HashingPolicy>::~IndexedTree()
 {}
@@ -206,15 +176,16 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
     std::sort(values_sorted.begin(), values_sorted.end(), comp);
 
     // Now that we have the sorted values we need to identify the leaves that need updating.
-    // This is performed sequentially and is stored in this 'leaf_insertion' struct
-    struct leaf_insertion {
-        index_t low_leaf_index;
-        indexed_leaf low_leaf;
-    };
-
+    // This is performed sequentially and is stored in a 'leaf_insertion' for each value
     std::vector<leaf_insertion> insertions(values.size());
     index_t old_size = leaves_.get_size();
 
+    // The new leaves are only added to the leaves index once the whole batch has been processed. Values are visited in
+    // descending order, so none of them can be the low leaf of a later one, except for a duplicate of the same value
+    std::vector<index_t> new_leaf_indices;
+    new_leaf_indices.reserve(values.size());
+    index_t previous_value_index = 0;
+
     for (size_t i = 0; i < values_sorted.size(); ++i) {
         fr value = values_sorted[i].first;
         index_t index_of_new_leaf = index_t(values_sorted[i].second) + old_size;
@@ -222,7 +193,12 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
         // This gives us the leaf that need updating
         index_t current;
         bool is_already_present;
-        std::tie(is_already_present, current) = leaves_.find_low_value(values_sorted[i].first);
+        if (i > 0 && value == values_sorted[i - 1].first) {
+            is_already_present = true;
+            current = previous_value_index;
+        } else {
+            std::tie(is_already_present, current) = leaves_.find_low_value(value);
+        }
         indexed_leaf current_leaf = leaves_.get_leaf(current);
 
         indexed_leaf new_leaf =
@@ -235,8 +211,10 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
             current_leaf.nextValue = value;
 
             leaves_.set_at_index(current, current_leaf, false);
-            leaves_.set_at_index(index_of_new_leaf, new_leaf, true);
+            leaves_.set_at_index(index_of_new_leaf, new_leaf, false);
+            new_leaf_indices.push_back(index_of_new_leaf);
         }
+        previous_value_index = is_already_present ? current : index_of_new_leaf;
 
         // Capture the index and value of the updated 'low' leaf
         leaf_insertion& insertion = insertions[i];
@@ -246,32 +224,11 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
                                            .nextValue = current_leaf.nextValue };
     }
 
-    // We now kick off multiple workers to perform the low leaf updates
-    // We create set of signals to coordinate the workers as the move up the tree
-    std::vector<fr_hash_path> paths(insertions.size());
-    std::vector<LevelSignal> signals;
-    // The first signal is set to 0. This ensure the first worker up the tree is not impeded
-    signals.emplace_back(size_t(0));
-    // Workers will follow their leaders up the tree, being trigger by the signal in front of them
-    for (size_t i = 0; i < insertions.size(); ++i) {
-        signals.emplace_back(size_t(1 + depth_));
-    }
+    std::reverse(new_leaf_indices.begin(), new_leaf_indices.end());
+    leaves_.add_to_index(new_leaf_indices);
 
-    if (no_multithreading) {
-        // Execute the jobs in series
-        for (size_t i = 0; i < insertions.size(); ++i) {
-            leaf_insertion& insertion = insertions[i];
-            update_leaf_and_hash_to_root(
-                insertion.low_leaf_index, insertion.low_leaf, signals[i], signals[i + 1], paths[i]);
-        }
-    } else {
-        // Execute the jobs in parallel
-        parallel_for(insertions.size(), [&](size_t i) {
-            leaf_insertion& insertion = insertions[i];
-            update_leaf_and_hash_to_root(
-                insertion.low_leaf_index, insertion.low_leaf, signals[i], signals[i + 1], paths[i]);
-        });
-    }
+    // Update the low leaves in the tree, capturing the hash path each of them replaces
+    std::vector<fr_hash_path> paths = update_low_leaves(insertions, no_multithreading);
 
     // Now that we have updated all of the low leaves, we insert the new leaves as a subtree at the end
     root_ = append_subtree(old_size);
@@ -280,87 +237,86 @@ std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::add_or
 }
 
 template <typename Store, typename LeavesStore, typename HashingPolicy>
-fr IndexedTree<Store, LeavesStore, HashingPolicy>::update_leaf_and_hash_to_root(const index_t& leaf_index,
-                                                                                const indexed_leaf& leaf)
-{
-    LevelSignal leader(0);
-    LevelSignal follower(0);
-    fr_hash_path hash_path;
-    return update_leaf_and_hash_to_root(leaf_index, leaf, leader, follower, hash_path);
-}
-
-template <typename Store, typename LeavesStore, typename HashingPolicy>
-fr IndexedTree<Store, LeavesStore, HashingPolicy>::update_leaf_and_hash_to_root(const index_t& leaf_index,
-                                                                                const indexed_leaf& leaf,
-                                                                                LevelSignal& leader,
-                                                                                LevelSignal& follower,
-                                                                                fr_hash_path& previous_hash_path)
+std::vector<fr_hash_path> IndexedTree<Store, LeavesStore, HashingPolicy>::update_low_leaves(
+    const std::vector<leaf_insertion>& insertions, bool no_multithreading)
 {
-    // We are a worker at a specific leaf index.
-    // We are going to move up the tree and at each node/level:
-    // 1. Wait for the level above to become 'signalled' as clear for us to write into
-    // 2. Read the node and it's sibling
-    // 3. Write the new node value
-    index_t index = leaf_index;
-    size_t level = depth_;
-    fr new_hash = HashingPolicy::hash(leaf.get_hash_inputs());
-
-    // Wait until we see that our leader has cleared 'depth_ - 1' (i.e. the level above the leaves that we are about to
-    // write into) this ensures that our leader is not still reading the leaves
-    size_t leader_level = depth_ - 1;
-    leader.wait_for_level(leader_level);
-
-    // Extract the value of the leaf node and it's sibling
-    bool is_right = bool(index & 0x01);
-    // extract the current leaf hash values for the previous hash path
-    fr current_right_value = get_element_or_zero(level, index + (is_right ? 0 : 1));
-    fr current_left_value = get_element_or_zero(level, is_right ? (index - 1) : index);
-    previous_hash_path.push_back(std::make_pair(current_left_value, current_right_value));
-
-    // Write the new leaf hash in place
-    write_node(level, index, new_hash);
-    // Signal that this level has been written
-    follower.signal_level(level);
-
-    while (level > 0) {
-        if (level > 1) {
-            // Level is > 1. Therefore we need to wait for our leader to have written to the level above meaning we can
-            // read from it
-            size_t level_to_read = level - 1;
-            leader_level = level_to_read;
-
-            leader.wait_for_level(leader_level);
-
-            // Now read the node and it's sibling
-            index_t index_of_node_above = index >> 1;
-            bool node_above_is_right = bool(index_of_node_above & 0x01);
-            fr above_right_value =
-                get_element_or_zero(level_to_read, index_of_node_above + (node_above_is_right ? 0 : 1));
-            fr above_left_value = get_element_or_zero(
-                level_to_read, node_above_is_right ? (index_of_node_above - 1) : index_of_node_above);
-            previous_hash_path.push_back(std::make_pair(above_left_value, above_right_value));
+    // The updates are applied as if one after the other: the hash path returned for an update is the one seen after all
+    // of the updates before it. Rather than walking each update up to the root, the tree is swept one level at a time.
+    // At each level every update computes the new value of its node, reading its sibling as left by the updates before
+    // it, so all of the hashes within a level are independent. Only the final value of each node is written.
+    const size_t num_insertions = insertions.size();
+    std::vector<fr_hash_path> paths(num_insertions);
+    if (num_insertions == 0) {
+        return paths;
+    }
+    auto for_each_insertion = [&](const std::function<void(size_t)>& func) {
+        if (no_multithreading || num_insertions <= MIN_PARALLEL_HASHES) {
+            for (size_t i = 0; i < num_insertions; ++i) {
+                func(i);
+            }
+        } else {
+            parallel_for(num_insertions, func);
         }
+    };
 
-        // Now that we have extracted the hash path from the row above
-        // we can compute the new hash at that level and write it
-        is_right = bool(index & 0x01);
-        fr new_right_value = is_right ? new_hash : get_element_or_zero(level, index + 1);
-        fr new_left_value = is_right ? get_element_or_zero(level, index - 1) : new_hash;
-        new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-        index >>= 1;
-        --level;
-        if (level > 0) {
-            // Before we write we need to ensure that our leader has already written to the row above it
-            // otherwise it could still be reading from this level
-            leader_level = level - 1;
-            leader.wait_for_level(leader_level);
+    // The node updated by each insertion at the current level and the value it leaves there
+    std::vector<size_t> nodes(num_insertions);
+    std::vector<fr> node_values(num_insertions);
+    for_each_insertion([&](size_t i) {
+        nodes[i] = size_t(insertions[i].low_leaf_index);
+        node_values[i] = HashingPolicy::hash(insertions[i].low_leaf.get_hash_inputs());
+        paths[i].reserve(depth_);
+    });
+
+    // For each insertion, the insertions that last updated its node and its sibling before it (if any) and whether it
+    // is the last to update its node
+    constexpr size_t NONE = std::numeric_limits<size_t>::max();
+    std::vector<size_t> previous_node_update(num_insertions);
+    std::vector<size_t> previous_sibling_update(num_insertions);
+    std::vector<uint8_t> is_final_update(num_insertions);
+    std::unordered_map<size_t, size_t> last_update;
+
+    for (size_t level = depth_; level > 0; --level) {
+        last_update.clear();
+        for (size_t i = 0; i < num_insertions; ++i) {
+            auto node_it = last_update.find(nodes[i]);
+            auto sibling_it = last_update.find(nodes[i] ^ 1);
+            previous_node_update[i] = node_it == last_update.end() ? NONE : node_it->second;
+            previous_sibling_update[i] = sibling_it == last_update.end() ? NONE : sibling_it->second;
+            last_update[nodes[i]] = i;
+            is_final_update[i] = 0;
+        }
+        for (const auto& [node, i] : last_update) {
+            is_final_update[i] = 1;
         }
 
-        // Write this node and signal that it is done
-        write_node(level, index, new_hash);
-        follower.signal_level(level);
+        for_each_insertion([&](size_t i) {
+            const size_t node = nodes[i];
+            const bool is_right = bool(node & 0x01);
+            const size_t previous = previous_node_update[i];
+            const size_t previous_sibling = previous_sibling_update[i];
+            const fr previous_value = previous == NONE ? get_element_or_zero(level, node) : node_values[previous];
+            const fr sibling_value =
+                previous_sibling == NONE ? get_element_or_zero(level, node ^ 1) : node_values[previous_sibling];
+            paths[i].push_back(is_right ? std::make_pair(sibling_value, previous_value)
+                                        : std::make_pair(previous_value, sibling_value));
+        });
+
+        // Every read of this level has been made, so the updated nodes can be written before moving up a level
+        for_each_insertion([&](size_t i) {
+            const size_t node = nodes[i];
+            const bool is_right = bool(node & 0x01);
+            if (is_final_update[i] != 0) {
+                write_node(level, node, node_values[i]);
+            }
+            const fr& sibling_value = is_right ? paths[i].back().first : paths[i].back().second;
+            node_values[i] = is_right ? HashingPolicy::hash_pair(sibling_value, node_values[i])
+                                      : HashingPolicy::hash_pair(node_values[i], sibling_value);
+            nodes[i] = node >> 1;
+        });
     }
-    return new_hash;
+    write_node(0, 0, node_values.back());
+    return paths;
 }
 
 template <typename Store, typename LeavesStore, typename HashingPolicy>
@@ -1,6 +1,7 @@
 #include "indexed_tree.hpp"
 #include "../array_store.hpp"
 #include "../hash.hpp"
+#include "../node_store.hpp"
 #include "../nullifier_tree/nullifier_memory_tree.hpp"
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/common/test.hpp"
@@ -131,6 +132,118 @@ TEST(stdlib_indexed_tree, test_batch_insert)
     }
 }
 
+TEST(stdlib_indexed_tree, test_large_batch_insert)
+{
+    // Large enough for each level of the low leaf updates to be hashed in parallel, with updates sharing nodes
+    const size_t batch_size = 256;
+    const size_t num_batches = 4;
+    size_t depth = 12;
+    NullifierMemoryTree<HashPolicy> memdb(depth, batch_size);
+
+    NodeStore store1(depth, 1UL << depth);
+    IndexedTree<NodeStore, LeavesCache, HashPolicy> tree1 =
+        IndexedTree<NodeStore, LeavesCache, HashPolicy>(store1, depth, batch_size);
+
+    NodeStore store2(depth, 1UL << depth);
+    IndexedTree<NodeStore, LeavesCache, HashPolicy> tree2 =
+        IndexedTree<NodeStore, LeavesCache, HashPolicy>(store2, depth, batch_size);
+
+    for (size_t i = 0; i < num_batches; i++) {
+        std::vector<fr> batch;
+        for (size_t j = 0; j < batch_size; j++) {
+            batch.push_back(fr(random_engine.get_random_uint256()));
+            memdb.update_element(batch[j]);
+        }
+        std::vector<fr_hash_path> tree1_hash_paths = tree1.add_or_update_values(batch, true);
+        std::vector<fr_hash_path> tree2_hash_paths = tree2.add_or_update_values(batch);
+        EXPECT_EQ(memdb.root(), tree1.root());
+        EXPECT_EQ(tree1.root(), tree2.root());
+        EXPECT_EQ(tree1_hash_paths, tree2_hash_paths);
+
+        for (size_t j = 0; j < 16; j++) {
+            const size_t index = (i + 1) * batch_size + j * 7;
+            EXPECT_EQ(memdb.get_hash_path(index), tree2.get_hash_path(index));
+        }
+    }
+}
+
+TEST(stdlib_indexed_tree, test_batch_insert_node_store)
+{
+    const size_t batch_size = 16;
+    const size_t num_batches = 16;
+    size_t depth = 10;
+    NullifierMemoryTree<HashPolicy> memdb(depth, batch_size);
+
+    NodeStore store(depth);
+    IndexedTree<NodeStore, LeavesCache, HashPolicy> tree =
+        IndexedTree<NodeStore, LeavesCache, HashPolicy>(store, depth, batch_size);
+
+    EXPECT_EQ(memdb.root(), tree.root());
+
+    for (size_t i = 0; i < num_batches; i++) {
+        std::vector<fr> batch;
+        for (size_t j = 0; j < batch_size; j++) {
+            batch.push_back(fr(random_engine.get_random_uint256()));
+            memdb.update_element(batch[j]);
+        }
+        tree.add_or_update_values(batch);
+        EXPECT_EQ(memdb.root(), tree.root());
+        EXPECT_EQ(memdb.get_hash_path(0), tree.get_hash_path(0));
+        EXPECT_EQ(memdb.get_hash_path(512), tree.get_hash_path(512));
+    }
+}
+
+TEST(stdlib_indexed_tree, test_fork)
+{
+    const size_t batch_size = 16;
+    size_t depth = 10;
+    NullifierMemoryTree<HashPolicy> memdb(depth, batch_size);
+
+    NodeStore store(depth);
+    IndexedTree<NodeStore, LeavesCache, HashPolicy> tree =
+        IndexedTree<NodeStore, LeavesCache, HashPolicy>(store, depth, batch_size);
+
+    auto random_batch = [&]() {
+        std::vector<fr> batch;
+        for (size_t j = 0; j < batch_size; j++) {
+            batch.push_back(fr(random_engine.get_random_uint256()));
+        }
+        return batch;
+    };
+    for (size_t i = 0; i < 4; i++) {
+        std::vector<fr> batch = random_batch();
+        for (const fr& value : batch) {
+            memdb.update_element(value);
+        }
+        tree.add_or_update_values(batch);
+    }
+
+    // The fork and the base tree insert different values on top of the shared state
+    NodeStore fork_store = store.fork();
+    IndexedTree<NodeStore, LeavesCache, HashPolicy> fork(fork_store, tree);
+    NullifierMemoryTree<HashPolicy> fork_memdb = memdb;
+    for (size_t i = 0; i < 4; i++) {
+        std::vector<fr> batch = random_batch();
+        for (const fr& value : batch) {
+            memdb.update_element(value);
+        }
+        tree.add_or_update_values(batch);
+
+        std::vector<fr> fork_batch = random_batch();
+        for (const fr& value : fork_batch) {
+            fork_memdb.update_element(value);
+        }
+        fork.add_or_update_values(fork_batch);
+    }
+
+    EXPECT_EQ(memdb.root(), tree.root());
+    EXPECT_EQ(fork_memdb.root(), fork.root());
+    for (size_t index : { 0UL, 40UL, 100UL }) {
+        EXPECT_EQ(memdb.get_hash_path(index), tree.get_hash_path(index));
+        EXPECT_EQ(fork_memdb.get_hash_path(index), fork.get_hash_path(index));
+    }
+}
+
 fr hash_leaf(const indexed_leaf& leaf)
 {
     return HashPolicy::hash(leaf.get_hash_inputs());
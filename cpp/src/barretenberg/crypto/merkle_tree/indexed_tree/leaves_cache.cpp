@@ -1,49 +1,57 @@
 #include "leaves_cache.hpp"
+#include <algorithm>
 
 namespace bb::crypto::merkle_tree {
 
 index_t LeavesCache::get_size() const
 {
-    return index_t(leaves_.size());
+    return index_t(size_);
 }
 
 std::pair<bool, index_t> LeavesCache::find_low_value(const fr& new_value) const
 {
-    std::map<uint256_t, index_t>::const_iterator it = indices_.lower_bound(new_value);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        return std::make_pair(false, it->second);
-    }
-    if (it->first == uint256_t(new_value)) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
-    }
-    // the iterator points to the element immediately larger than the requested value
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->second);
+    // The index always holds the zero leaf, so there is a leaf with a value not greater than any requested value
+    std::optional<OrderedIndex::Entry> low = indices_.find_floor(uint256_t(new_value));
+    ASSERT(low.has_value());
+    return std::make_pair(low->first == uint256_t(new_value), index_t(low->second));
 }
 indexed_leaf LeavesCache::get_leaf(const index_t& index) const
 {
-    ASSERT(index >= 0 && index < leaves_.size());
-    return leaves_[size_t(index)];
+    ASSERT(index >= 0 && index < size_);
+    const auto i = size_t(index);
+    return (*pages_[i / PAGE_SIZE])[i % PAGE_SIZE];
 }
 void LeavesCache::set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index)
 {
-    if (index >= leaves_.size()) {
-        leaves_.resize(size_t(index + 1));
-    }
-    leaves_[size_t(index)] = leaf;
+    writable_leaf(size_t(index)) = leaf;
     if (add_to_index) {
-        indices_[uint256_t(leaf.value)] = index;
+        indices_.insert(uint256_t(leaf.value), size_t(index));
     }
 }
 void LeavesCache::append_leaf(const indexed_leaf& leaf)
 {
-    index_t next_index = leaves_.size();
+    index_t next_index = size_;
     set_at_index(next_index, leaf, true);
 }
+void LeavesCache::add_to_index(const std::vector<index_t>& leaf_indices)
+{
+    std::vector<OrderedIndex::Entry> entries(leaf_indices.size());
+    for (size_t i = 0; i < leaf_indices.size(); ++i) {
+        entries[i] = std::make_pair(uint256_t(get_leaf(leaf_indices[i]).value), size_t(leaf_indices[i]));
+    }
+    indices_.insert_sorted(entries);
+}
+indexed_leaf& LeavesCache::writable_leaf(size_t index)
+{
+    size_ = std::max(size_, index + 1);
+    while (pages_.size() * PAGE_SIZE < size_) {
+        pages_.push_back(std::make_shared<Page>(PAGE_SIZE));
+    }
+    std::shared_ptr<Page>& page = pages_[index / PAGE_SIZE];
+    if (page.use_count() > 1) {
+        page = std::make_shared<Page>(*page);
+    }
+    return (*page)[index % PAGE_SIZE];
+}
 
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
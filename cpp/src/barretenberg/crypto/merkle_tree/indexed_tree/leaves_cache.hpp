@@ -1,15 +1,19 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "indexed_leaf.hpp"
+#include "ordered_index.hpp"
+#include <memory>
 
 namespace bb::crypto::merkle_tree {
 
 typedef uint256_t index_t;
 
 /**
- * @brief Used to facilitate testing of the IndexedTree. Stores leaves in memory with an index for O(logN) retrieval of
- * 'low leaves'
+ * @brief Used to facilitate testing of the IndexedTree. Stores leaves in memory with an ordered index for O(logN)
+ * retrieval of 'low leaves'
  *
+ * @details Leaves are held in pages shared between copies of the cache and copied on their first modification, so a
+ * forked tree does not copy the leaves it does not change.
  */
 class LeavesCache {
   public:
@@ -19,9 +23,22 @@ class LeavesCache {
     void set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index);
     void append_leaf(const indexed_leaf& leaf);
 
+    /**
+     * @brief Adds a batch of stored leaves to the index
+     * @param leaf_indices The indices of the leaves, ordered by strictly ascending leaf value
+     */
+    void add_to_index(const std::vector<index_t>& leaf_indices);
+
   private:
-    std::map<uint256_t, index_t> indices_;
-    std::vector<indexed_leaf> leaves_;
+    // Number of leaves held by each page
+    static constexpr size_t PAGE_SIZE = 1024;
+    using Page = std::vector<indexed_leaf>;
+
+    indexed_leaf& writable_leaf(size_t index);
+
+    OrderedIndex indices_;
+    std::vector<std::shared_ptr<Page>> pages_;
+    size_t size_ = 0;
 };
 
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
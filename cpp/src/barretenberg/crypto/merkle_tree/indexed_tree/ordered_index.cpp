@@ -0,0 +1,136 @@
+#include "ordered_index.hpp"
+#include "barretenberg/common/assert.hpp"
+#include <algorithm>
+
+namespace bb::crypto::merkle_tree {
+
+size_t OrderedIndex::find_block(const uint256_t& key) const
+{
+    // The last block starting at or before key, or the first block if key precedes every entry
+    auto it = std::upper_bound(first_keys_.begin(), first_keys_.end(), key);
+    return it == first_keys_.begin() ? 0 : static_cast<size_t>(it - first_keys_.begin()) - 1;
+}
+
+std::optional<OrderedIndex::Entry> OrderedIndex::find_floor(const uint256_t& key) const
+{
+    auto block_it = std::upper_bound(first_keys_.begin(), first_keys_.end(), key);
+    if (block_it == first_keys_.begin()) {
+        return std::nullopt;
+    }
+    const Block& block = *blocks_[static_cast<size_t>(block_it - first_keys_.begin()) - 1];
+    // The block starts at or before key, so the search within it can not return the first entry
+    auto it = std::upper_bound(block.keys.begin(), block.keys.end(), key);
+    const auto i = static_cast<size_t>(it - block.keys.begin()) - 1;
+    return Entry(block.keys[i], block.values[i]);
+}
+
+void OrderedIndex::insert(const uint256_t& key, size_t value)
+{
+    if (blocks_.empty()) {
+        blocks_.push_back(std::make_shared<Block>(Block{ .keys = { key }, .values = { value } }));
+        first_keys_.push_back(key);
+        size_ = 1;
+        return;
+    }
+    const size_t block_index = find_block(key);
+    Block& block = writable_block(block_index);
+    auto it = std::lower_bound(block.keys.begin(), block.keys.end(), key);
+    const auto i = static_cast<std::ptrdiff_t>(it - block.keys.begin());
+    if (it != block.keys.end() && *it == key) {
+        block.values[static_cast<size_t>(i)] = value;
+        return;
+    }
+    block.keys.insert(it, key);
+    block.values.insert(block.values.begin() + i, value);
+    first_keys_[block_index] = block.keys.front();
+    ++size_;
+    split_block(block_index);
+}
+
+void OrderedIndex::insert_sorted(const std::vector<Entry>& entries)
+{
+    size_t i = 0;
+    while (i < entries.size()) {
+        if (blocks_.empty()) {
+            insert(entries[i].first, entries[i].second);
+            ++i;
+            continue;
+        }
+        // Gather the run of entries that fall into the same block and merge them in a single pass
+        const size_t block_index = find_block(entries[i].first);
+        size_t end = entries.size();
+        if (block_index + 1 < blocks_.size()) {
+            end = i + 1;
+            while (end < entries.size() && entries[end].first < first_keys_[block_index + 1]) {
+                ++end;
+            }
+        }
+
+        const Block& block = *blocks_[block_index];
+        Block merged;
+        merged.keys.reserve(block.keys.size() + end - i);
+        merged.values.reserve(block.keys.size() + end - i);
+        size_t j = 0;
+        while (j < block.keys.size() || i < end) {
+            if (i == end || (j < block.keys.size() && block.keys[j] < entries[i].first)) {
+                merged.keys.push_back(block.keys[j]);
+                merged.values.push_back(block.values[j]);
+                ++j;
+                continue;
+            }
+            ASSERT(i + 1 == end || entries[i].first < entries[i + 1].first);
+            if (j < block.keys.size() && block.keys[j] == entries[i].first) {
+                ++j;
+            } else {
+                ++size_;
+            }
+            merged.keys.push_back(entries[i].first);
+            merged.values.push_back(entries[i].second);
+            ++i;
+        }
+        blocks_[block_index] = std::make_shared<Block>(std::move(merged));
+        first_keys_[block_index] = blocks_[block_index]->keys.front();
+        split_block(block_index);
+    }
+}
+
+OrderedIndex::Block& OrderedIndex::writable_block(size_t block_index)
+{
+    std::shared_ptr<Block>& block = blocks_[block_index];
+    if (block.use_count() > 1) {
+        block = std::make_shared<Block>(*block);
+    }
+    return *block;
+}
+
+void OrderedIndex::split_block(size_t block_index)
+{
+    const size_t block_size = blocks_[block_index]->keys.size();
+    if (block_size <= MAX_BLOCK_SIZE) {
+        return;
+    }
+    Block& block = writable_block(block_index);
+    // Every piece holds at least half of the maximum, the last one takes the remainder
+    constexpr size_t piece_size = MAX_BLOCK_SIZE / 2;
+    const size_t num_pieces = block_size / piece_size;
+    std::vector<std::shared_ptr<Block>> pieces(num_pieces - 1);
+    std::vector<uint256_t> piece_first_keys(num_pieces - 1);
+    for (size_t piece = 1; piece < num_pieces; ++piece) {
+        const auto start = static_cast<std::ptrdiff_t>(piece * piece_size);
+        const auto end = piece + 1 == num_pieces ? static_cast<std::ptrdiff_t>(block_size)
+                                                   : start + static_cast<std::ptrdiff_t>(piece_size);
+        pieces[piece - 1] = std::make_shared<Block>(
+            Block{ .keys = std::vector<uint256_t>(block.keys.begin() + start, block.keys.begin() + end),
+                   .values = std::vector<size_t>(block.values.begin() + start, block.values.begin() + end) });
+        piece_first_keys[piece - 1] = pieces[piece - 1]->keys.front();
+    }
+    block.keys.resize(piece_size);
+    block.values.resize(piece_size);
+
+    const auto insert_at = static_cast<std::ptrdiff_t>(block_index + 1);
+    blocks_.insert(
+        blocks_.begin() + insert_at, std::make_move_iterator(pieces.begin()), std::make_move_iterator(pieces.end()));
+    first_keys_.insert(first_keys_.begin() + insert_at, piece_first_keys.begin(), piece_first_keys.end());
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,61 @@
+#pragma once
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief An ordered map from leaf values to leaf indices, supporting predecessor ('low leaf') queries
+ *
+ * @details Entries are kept sorted in blocks of contiguous keys, together with the first key of every block. A query is
+ * a binary search over the block keys followed by a binary search within a single block, and an insertion shifts the
+ * entries of a single block. A batch of sorted entries is merged into each block it touches in one pass.
+ *
+ * Blocks are shared between copies of an index and copied on their first modification, so copying an index costs a
+ * pointer per block rather than a copy of every entry.
+ */
+class OrderedIndex {
+  public:
+    using Entry = std::pair<uint256_t, size_t>;
+
+    // Blocks holding more entries than this are split into blocks of half this size
+    static constexpr size_t MAX_BLOCK_SIZE = 512;
+
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Inserts the given entry, replacing the value of an existing entry with the same key
+     */
+    void insert(const uint256_t& key, size_t value);
+
+    /**
+     * @brief Inserts a batch of entries, replacing the values of existing entries with the same keys
+     * @param entries The entries to insert, in strictly ascending key order
+     */
+    void insert_sorted(const std::vector<Entry>& entries);
+
+    /**
+     * @brief Returns the entry with the largest key not greater than the given key, if there is one
+     */
+    std::optional<Entry> find_floor(const uint256_t& key) const;
+
+  private:
+    struct Block {
+        std::vector<uint256_t> keys;
+        std::vector<size_t> values;
+    };
+
+    size_t find_block(const uint256_t& key) const;
+    Block& writable_block(size_t block_index);
+    void split_block(size_t block_index);
+
+    std::vector<uint256_t> first_keys_;
+    std::vector<std::shared_ptr<Block>> blocks_;
+    size_t size_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,106 @@
+#include "ordered_index.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <map>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+void expect_same_floors(const OrderedIndex& index, const std::map<uint256_t, size_t>& expected)
+{
+    EXPECT_EQ(index.size(), expected.size());
+    for (size_t i = 0; i < 256; ++i) {
+        const uint256_t key = engine.get_random_uint32() % 100010;
+        std::optional<OrderedIndex::Entry> floor = index.find_floor(key);
+        auto it = expected.upper_bound(key);
+        if (it == expected.begin()) {
+            EXPECT_FALSE(floor.has_value());
+            continue;
+        }
+        --it;
+        ASSERT_TRUE(floor.has_value());
+        EXPECT_EQ(floor->first, it->first);
+        EXPECT_EQ(floor->second, it->second);
+    }
+}
+} // namespace
+
+TEST(stdlib_ordered_index, find_floor)
+{
+    OrderedIndex index;
+    EXPECT_FALSE(index.find_floor(5).has_value());
+
+    index.insert(10, 1);
+    index.insert(30, 2);
+    index.insert(20, 3);
+    EXPECT_FALSE(index.find_floor(9).has_value());
+    EXPECT_EQ(index.find_floor(10), OrderedIndex::Entry(10, 1));
+    EXPECT_EQ(index.find_floor(25), OrderedIndex::Entry(20, 3));
+    EXPECT_EQ(index.find_floor(1000), OrderedIndex::Entry(30, 2));
+
+    // Inserting an existing key replaces its value
+    index.insert(20, 4);
+    EXPECT_EQ(index.size(), 3UL);
+    EXPECT_EQ(index.find_floor(20), OrderedIndex::Entry(20, 4));
+}
+
+TEST(stdlib_ordered_index, matches_map)
+{
+    OrderedIndex index;
+    std::map<uint256_t, size_t> expected;
+
+    for (size_t round = 0; round < 64; ++round) {
+        if (round % 3 == 0) {
+            for (size_t i = 0; i < 64; ++i) {
+                const uint256_t key = engine.get_random_uint32() % 100000;
+                index.insert(key, i);
+                expected[key] = i;
+            }
+        } else {
+            // Large batches split blocks many times over in a single merge
+            std::map<uint256_t, size_t> batch;
+            const size_t batch_size = round % 7 == 0 ? 4096 : 32;
+            for (size_t i = 0; i < batch_size; ++i) {
+                batch[engine.get_random_uint32() % 100000] = round * batch_size + i;
+            }
+            index.insert_sorted(std::vector<OrderedIndex::Entry>(batch.begin(), batch.end()));
+            for (const auto& [key, value] : batch) {
+                expected[key] = value;
+            }
+        }
+        expect_same_floors(index, expected);
+    }
+}
+
+TEST(stdlib_ordered_index, copies_are_independent)
+{
+    OrderedIndex index;
+    std::map<uint256_t, size_t> expected;
+    for (size_t i = 0; i < 4096; ++i) {
+        const uint256_t key = engine.get_random_uint32() % 100000;
+        index.insert(key, i);
+        expected[key] = i;
+    }
+
+    OrderedIndex copy = index;
+    std::map<uint256_t, size_t> expected_copy = expected;
+    for (size_t i = 0; i < 1024; ++i) {
+        const uint256_t key = engine.get_random_uint32() % 100000;
+        copy.insert(key, i);
+        expected_copy[key] = i;
+    }
+    std::map<uint256_t, size_t> batch;
+    for (size_t i = 0; i < 1024; ++i) {
+        batch[engine.get_random_uint32() % 100000] = i;
+    }
+    index.insert_sorted(std::vector<OrderedIndex::Entry>(batch.begin(), batch.end()));
+    for (const auto& [key, value] : batch) {
+        expected[key] = value;
+    }
+
+    expect_same_floors(index, expected);
+    expect_same_floors(copy, expected_copy);
+}
@@ -1,14 +1,28 @@
 #pragma once
 #include "barretenberg/common/streams.hpp"
 #include "hash_path.hpp"
+#include <functional>
 #include <map>
+#include <memory>
 #include <set>
 
 namespace bb::crypto::merkle_tree {
 
+/**
+ * @brief An in-memory key/value store with a layer of uncommitted puts and deletes on top of the committed state.
+ *
+ * @details The committed state is split by key hash into pages that are shared between copies of the store, and a
+ * page is only copied when a commit changes it while it is shared. Copying a store is therefore cheap, which allows a
+ * tree state to be forked, speculatively updated and then either kept or discarded.
+ */
 class MemoryStore {
   public:
-    MemoryStore() {}
+    // Number of pages the committed state is split into
+    static constexpr size_t NUM_PAGES = 256;
+
+    MemoryStore()
+        : pages_(NUM_PAGES)
+    {}
 
     MemoryStore(MemoryStore const& rhs) = default;
     MemoryStore(MemoryStore&& rhs) = default;
@@ -48,9 +62,12 @@ class MemoryStore {
             value = std::vector<uint8_t>(it->second.begin(), it->second.end());
             return true;
         } else {
-            std::string result;
-            auto it = store_.find(key);
-            if (it != store_.end()) {
+            const auto& page = pages_[page_index(key)];
+            if (!page) {
+                return false;
+            }
+            auto it = page->find(key);
+            if (it != page->end()) {
                 value = { it->second.begin(), it->second.end() };
                 return true;
             }
@@ -61,10 +78,10 @@ class MemoryStore {
     void commit()
     {
         for (auto it : puts_) {
-            store_.insert(it);
+            writable_page(it.first).insert_or_assign(it.first, it.second);
         }
         for (auto key : deletes_) {
-            store_.erase(key);
+            writable_page(key).erase(key);
         }
         puts_.clear();
         deletes_.clear();
@@ -79,7 +96,22 @@ class MemoryStore {
   private:
     std::string to_string(std::vector<uint8_t> const& input) { return std::string((char*)input.data(), input.size()); }
 
-    std::map<std::string, std::string> store_;
+    using Page = std::map<std::string, std::string>;
+
+    static size_t page_index(std::string const& key) { return std::hash<std::string>{}(key) % NUM_PAGES; }
+
+    Page& writable_page(std::string const& key)
+    {
+        auto& page = pages_[page_index(key)];
+        if (!page) {
+            page = std::make_shared<Page>();
+        } else if (page.use_count() > 1) {
+            page = std::make_shared<Page>(*page);
+        }
+        return *page;
+    }
+
+    std::vector<std::shared_ptr<Page>> pages_;
     std::map<std::string, std::string> puts_;
     std::set<std::string> deletes_;
 };
@@ -24,6 +24,12 @@ template <typename HashingPolicy> class MemoryTree {
   public:
     MemoryTree(size_t depth);
 
+    /**
+     * @brief Builds a tree holding the given leaves, followed by zero leaves
+     * @param num_threads The number of threads to hash the lower layers of the tree with
+     */
+    MemoryTree(size_t depth, std::vector<fr> const& leaves, size_t num_threads = get_num_cpus());
+
     fr_hash_path get_hash_path(size_t index);
 
     fr_sibling_path get_sibling_path(size_t index);
@@ -61,6 +67,26 @@ MemoryTree<HashingPolicy>::MemoryTree(size_t depth)
     root_ = current;
 }
 
+template <typename HashingPolicy>
+MemoryTree<HashingPolicy>::MemoryTree(size_t depth, std::vector<fr> const& leaves, size_t num_threads)
+    : depth_(depth)
+{
+    ASSERT(depth_ >= 1 && depth <= 20);
+    total_size_ = 1UL << depth_;
+    ASSERT(leaves.size() <= total_size_);
+    hashes_.resize(total_size_ * 2 - 2);
+    std::copy(leaves.begin(), leaves.end(), hashes_.begin());
+
+    // Build each layer from the one below it, the last layer holds the two children of the root.
+    std::span<fr> hashes(hashes_);
+    size_t offset = 0;
+    for (size_t layer_size = total_size_; layer_size > 2; offset += layer_size, layer_size /= 2) {
+        hash_layer<HashingPolicy>(
+            hashes.subspan(offset, layer_size), hashes.subspan(offset + layer_size, layer_size / 2), num_threads);
+    }
+    root_ = HashingPolicy::hash_pair(hashes_[offset], hashes_[offset + 1]);
+}
+
 template <typename HashingPolicy> fr_hash_path MemoryTree<HashingPolicy>::get_hash_path(size_t index)
 {
     fr_hash_path path(depth_);
@@ -80,3 +80,24 @@ TEST(crypto_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(crypto_merkle_tree, test_memory_tree_from_leaves)
+{
+    constexpr size_t depth = 10;
+    std::vector<fr> leaves(700);
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        leaves[i] = fr(i * i + 1);
+    }
+    MemoryTree<Poseidon2HashPolicy> expected(depth);
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        expected.update_element(i, leaves[i]);
+    }
+
+    for (size_t num_threads : { 1UL, 3UL, 8UL }) {
+        MemoryTree<Poseidon2HashPolicy> db(depth, leaves, num_threads);
+        EXPECT_EQ(db.root(), expected.root());
+        EXPECT_EQ(db.get_hash_path(0), expected.get_hash_path(0));
+        EXPECT_EQ(db.get_hash_path(699), expected.get_hash_path(699));
+        EXPECT_EQ(db.get_hash_path(1023), expected.get_hash_path(1023));
+    }
+}
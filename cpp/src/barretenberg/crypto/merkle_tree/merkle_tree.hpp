@@ -18,6 +18,13 @@ template <typename Store, typename HashingPolicy> class MerkleTree {
     typedef uint256_t index_t;
 
     MerkleTree(Store& store, size_t depth, uint8_t tree_id = 0);
+
+    /**
+     * @brief Constructs a fork of `base` backed by `store`, which must be a copy of the store backing `base`.
+     * The tree state lives entirely in the store, so the fork is committed by assigning its store back to the store of
+     * `base`, or discarded by dropping it.
+     */
+    MerkleTree(Store& store, MerkleTree const& base);
     MerkleTree(MerkleTree const& other) = delete;
     MerkleTree(MerkleTree&& other);
     ~MerkleTree();
@@ -126,6 +133,14 @@ MerkleTree<Store, HashingPolicy>::MerkleTree(Store& store, size_t depth, uint8_t
     }
 }
 
+template <typename Store, typename HashingPolicy>
+MerkleTree<Store, HashingPolicy>::MerkleTree(Store& store, MerkleTree const& base)
+    : store_(store)
+    , zero_hashes_(base.zero_hashes_)
+    , depth_(base.depth_)
+    , tree_id_(base.tree_id_)
+{}
+
 template <typename Store, typename HashingPolicy>
 MerkleTree<Store, HashingPolicy>::MerkleTree(MerkleTree&& other)
     : store_(other.store_)
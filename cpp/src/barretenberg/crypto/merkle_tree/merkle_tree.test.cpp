@@ -81,6 +81,40 @@ TEST(crypto_merkle_tree, test_size)
     EXPECT_EQ(db.size(), 3ULL);
 }
 
+TEST(crypto_merkle_tree, test_fork)
+{
+    constexpr size_t depth = 10;
+    MemoryTree<PedersenHashPolicy> memdb(depth);
+    MemoryStore store;
+    MerkleTree<MemoryStore, PedersenHashPolicy> db(store, depth);
+    for (size_t i = 0; i < 64; ++i) {
+        memdb.update_element(i, VALUES[i]);
+        db.update_element(i, VALUES[i]);
+    }
+    store.commit();
+    const fr base_root = db.root();
+
+    MemoryStore fork_store = store;
+    MerkleTree<MemoryStore, PedersenHashPolicy> fork(fork_store, db);
+    MemoryTree<PedersenHashPolicy> fork_memdb = memdb;
+    for (size_t i = 32; i < 96; ++i) {
+        fork_memdb.update_element(i, VALUES[i + 1]);
+        fork.update_element(i, VALUES[i + 1]);
+    }
+    fork_store.commit();
+    EXPECT_EQ(fork.root(), fork_memdb.root());
+    EXPECT_EQ(fork.get_hash_path(40), fork_memdb.get_hash_path(40));
+
+    // The base tree does not see the updates made to the fork
+    EXPECT_EQ(db.root(), base_root);
+    EXPECT_EQ(db.get_hash_path(40), memdb.get_hash_path(40));
+
+    // Committing the fork's store makes its state the state of the base tree
+    store = fork_store;
+    EXPECT_EQ(db.root(), fork_memdb.root());
+    EXPECT_EQ(db.get_hash_path(90), fork_memdb.get_hash_path(90));
+}
+
 TEST(crypto_merkle_tree, test_get_hash_path)
 {
     MemoryTree<PedersenHashPolicy> memdb(10);
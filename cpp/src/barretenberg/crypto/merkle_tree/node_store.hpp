@@ -0,0 +1,201 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A typed backing store for merkle trees holding the nodes of each level contiguously.
+ * Level l can hold up to min(2^l, 'indices') nodes. Presence of a node is tracked in a bitmap, so a read is a single
+ * bit test and a copy of the field element, with no serialisation or per-node allocation.
+ *
+ * @details Nodes are held in fixed size pages, allocated on first write. Nodes at distinct positions may be written
+ * concurrently (the bitmap is updated atomically). For large trees the pages can be placed in a file mapping instead of
+ * anonymous memory, letting the kernel page them out.
+ *
+ * A store can be forked: the fork shares every page with the original store, and a shared page is copied by whichever
+ * store writes to it first. Forking costs one pointer per page, independent of the number of nodes.
+ */
+class NodeStore {
+  public:
+    // Number of nodes held by each page
+    static constexpr size_t PAGE_SIZE = 512;
+
+    NodeStore(size_t levels, size_t indices = 1024)
+        : NodeStore(levels, indices, "")
+    {}
+
+    /**
+     * @brief Constructs a store whose pages live in a shared mapping of the file at backing_path
+     * The file is created (or truncated) to the required size. Falls back to anonymous memory if the file can not be
+     * mapped, or if backing_path is empty.
+     */
+    NodeStore(size_t levels, size_t indices, std::string const& backing_path)
+    {
+        level_offsets_.resize(levels + 2);
+        for (size_t level = 0; level <= levels; ++level) {
+            const size_t capacity = level < 64 ? std::min(indices, size_t(1) << level) : indices;
+            level_offsets_[level + 1] = level_offsets_[level] + capacity;
+        }
+        allocate_page_table((level_offsets_.back() + PAGE_SIZE - 1) / PAGE_SIZE);
+        if (!backing_path.empty()) {
+            map_file(backing_path);
+        }
+    }
+    NodeStore(NodeStore const& other) = delete;
+    NodeStore(NodeStore&& other) = delete;
+    ~NodeStore() {}
+
+    /**
+     * @brief Returns a fork of this store, holding the same nodes
+     * Writes to either store are not visible to the other. Must not be called concurrently with writes to this store.
+     */
+    NodeStore fork() { return NodeStore(*this, ForkTag{}); }
+
+    size_t capacity(size_t level) const { return level_offsets_[level + 1] - level_offsets_[level]; }
+
+    void put_node(size_t level, size_t index, const fr& value)
+    {
+        ASSERT(index < capacity(level));
+        const size_t position = level_offsets_[level] + index;
+        const size_t slot = position % PAGE_SIZE;
+        Page& page = writable_page(position / PAGE_SIZE);
+        page.nodes[slot] = value;
+        page.present[slot / 64].fetch_or(uint64_t(1) << (slot % 64), std::memory_order_release);
+    }
+
+    bool get_node(size_t level, size_t index, fr& value) const
+    {
+        if (index >= capacity(level)) {
+            return false;
+        }
+        const size_t position = level_offsets_[level] + index;
+        const size_t slot = position % PAGE_SIZE;
+        const Page* page = pages_[position / PAGE_SIZE].load(std::memory_order_acquire);
+        if (page == nullptr) {
+            return false;
+        }
+        const uint64_t word = page->present[slot / 64].load(std::memory_order_acquire);
+        if ((word & (uint64_t(1) << (slot % 64))) == 0) {
+            return false;
+        }
+        value = page->nodes[slot];
+        return true;
+    }
+
+  private:
+    struct Page {
+        std::array<fr, PAGE_SIZE> nodes;
+        std::array<std::atomic<uint64_t>, PAGE_SIZE / 64> present{};
+    };
+
+    struct ForkTag {};
+
+    // Constructs a fork of base, see fork()
+    NodeStore(NodeStore& base, ForkTag)
+        : level_offsets_(base.level_offsets_)
+        , owners_(base.owners_)
+    {
+        allocate_page_table(owners_.size());
+        base.retired_.clear();
+        for (size_t i = 0; i < owners_.size(); ++i) {
+            pages_[i].store(base.pages_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            base.writable_[i].store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void allocate_page_table(size_t num_pages)
+    {
+        owners_.resize(num_pages);
+        pages_ = std::make_unique<std::atomic<Page*>[]>(num_pages);
+        writable_ = std::make_unique<std::atomic<bool>[]>(num_pages);
+    }
+
+    /**
+     * @brief Returns the page at page_index for writing, allocating it or taking a private copy of it if required
+     */
+    Page& writable_page(size_t page_index)
+    {
+        if (writable_[page_index].load(std::memory_order_acquire)) {
+            return *pages_[page_index].load(std::memory_order_relaxed);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!writable_[page_index].load(std::memory_order_relaxed)) {
+            std::shared_ptr<Page>& owner = owners_[page_index];
+            if (!owner || owner.use_count() > 1) {
+                auto page = std::make_shared<Page>();
+                if (owner) {
+                    page->nodes = owner->nodes;
+                    for (size_t i = 0; i < page->present.size(); ++i) {
+                        page->present[i].store(owner->present[i].load(std::memory_order_relaxed),
+                                               std::memory_order_relaxed);
+                    }
+                    // Concurrent readers may still hold the shared page
+                    retired_.push_back(std::move(owner));
+                }
+                owner = std::move(page);
+                pages_[page_index].store(owner.get(), std::memory_order_release);
+            }
+            writable_[page_index].store(true, std::memory_order_release);
+        }
+        return *pages_[page_index].load(std::memory_order_relaxed);
+    }
+
+    void map_file(std::string const& path)
+    {
+#ifdef __wasm__
+        static_cast<void>(path);
+#else
+        const size_t num_pages = owners_.size();
+        const size_t size = num_pages * sizeof(Page);
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            return;
+        }
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            close(fd);
+            return;
+        }
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+            return;
+        }
+        // Every page shares ownership of the mapping, which is unmapped once no store references any of them
+        std::shared_ptr<void> mapping(base, [size](void* address) { munmap(address, size); });
+        auto* pages = static_cast<Page*>(base);
+        for (size_t i = 0; i < num_pages; ++i) {
+            Page* page = new (&pages[i]) Page;
+            owners_[i] = std::shared_ptr<Page>(mapping, page);
+            pages_[i].store(page, std::memory_order_relaxed);
+            writable_[i].store(true, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    // Offset of the first node of each level, counting nodes across all pages
+    std::vector<size_t> level_offsets_;
+    // Keeps the pages referenced by this store alive, null for pages that have not been written
+    std::vector<std::shared_ptr<Page>> owners_;
+    // The pages referenced by this store, readable without taking the mutex
+    std::unique_ptr<std::atomic<Page*>[]> pages_;
+    // Whether each page is private to this store, and so can be written in place
+    std::unique_ptr<std::atomic<bool>[]> writable_;
+    // Shared pages replaced by a private copy, kept alive until the next fork
+    std::vector<std::shared_ptr<Page>> retired_;
+    std::mutex mutex_;
+};
+} // namespace bb::crypto::merkle_tree
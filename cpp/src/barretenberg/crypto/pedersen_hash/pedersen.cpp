@@ -1,5 +1,8 @@
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/assert.hpp"
+#include <map>
+#include <mutex>
 
 namespace bb::crypto {
 
@@ -79,5 +82,119 @@ typename Curve::BaseField pedersen_hash_base<Curve>::hash_buffer(const std::vect
     return result;
 }
 
+/**
+ * @brief Fixed-base tables for the two generators used by a hash of two inputs
+ *
+ * @details Scalars are split into 4-bit windows. Entry j * WINDOW_ENTRIES + (d - 1) of a generator's table holds
+ * d.2^(4j).[g], so multiplying a generator by a scalar costs one mixed addition per non-zero window and no doublings.
+ */
+template <typename Curve> struct pedersen_hash_base<Curve>::PairTables {
+    static constexpr size_t WINDOW_BITS = 4;
+    static constexpr size_t NUM_WINDOWS = 256 / WINDOW_BITS;
+    static constexpr size_t WINDOW_ENTRIES = (1UL << WINDOW_BITS) - 1;
+    static constexpr uint64_t WINDOW_MASK = (1UL << WINDOW_BITS) - 1;
+
+    std::array<std::vector<AffineElement>, 2> generator_tables;
+    // 2.[h], the length term common to every hash of two inputs
+    AffineElement length_term;
+
+    PairTables(std::span<const AffineElement> generators)
+    {
+        std::vector<Element> points(2 * NUM_WINDOWS * WINDOW_ENTRIES + 1);
+        for (size_t k = 0; k < 2; ++k) {
+            Element base(generators[k]);
+            for (size_t j = 0; j < NUM_WINDOWS; ++j) {
+                Element current = base;
+                for (size_t d = 0; d < WINDOW_ENTRIES; ++d) {
+                    points[(k * NUM_WINDOWS + j) * WINDOW_ENTRIES + d] = current;
+                    current += base;
+                }
+                base = current;
+            }
+        }
+        points.back() = length_generator * Fr(2);
+        Element::batch_normalize(points.data(), points.size());
+
+        for (size_t k = 0; k < 2; ++k) {
+            generator_tables[k].reserve(NUM_WINDOWS * WINDOW_ENTRIES);
+            for (size_t i = 0; i < NUM_WINDOWS * WINDOW_ENTRIES; ++i) {
+                const Element& point = points[k * NUM_WINDOWS * WINDOW_ENTRIES + i];
+                generator_tables[k].emplace_back(point.x, point.y);
+            }
+        }
+        length_term = AffineElement(points.back().x, points.back().y);
+    }
+};
+
+/**
+ * @brief Returns the fixed-base tables for the generators of `context`, building them on first use.
+ * Tables of the default generator data are shared between all callers using the same domain separator and generator
+ * offset. A context pointing at other generator data gets tables built for that call only.
+ */
+template <typename Curve>
+std::shared_ptr<const typename pedersen_hash_base<Curve>::PairTables> pedersen_hash_base<Curve>::get_pair_tables(
+    const GeneratorContext& context)
+{
+    if (context.generators != generator_data<Curve>::get_default_generators()) {
+        return std::make_shared<const PairTables>(context.generators->get(2, context.offset, context.domain_separator));
+    }
+
+    static std::mutex mutex;
+    static std::map<std::pair<std::string, size_t>, std::shared_ptr<const PairTables>> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto key = std::make_pair(context.domain_separator, context.offset);
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        auto generators = context.generators->get(2, context.offset, context.domain_separator);
+        it = cache.emplace(key, std::make_shared<const PairTables>(generators)).first;
+    }
+    return it->second;
+}
+
+/**
+ * @brief Computes outputs[i] = hash({ inputs[2i], inputs[2i + 1] }, context) for every i.
+ *
+ * @details Each hash is accumulated from precomputed multiples of the generators (see PairTables), and the results are
+ * converted to affine form with a single batch inversion, rather than one inversion per hash.
+ *
+ * @param inputs The pairs to hash, must hold exactly twice as many elements as outputs
+ * @param outputs Receives the hash of each pair
+ * @param context Stores generator metadata + context pointer to the generators we are using for this hash
+ */
+template <typename Curve>
+void pedersen_hash_base<Curve>::hash_pairs(std::span<const Fq> inputs,
+                                           std::span<Fq> outputs,
+                                           const GeneratorContext context)
+{
+    ASSERT(inputs.size() == 2 * outputs.size());
+    if (outputs.empty()) {
+        return;
+    }
+    using Tables = PairTables;
+    const auto tables = get_pair_tables(context);
+
+    std::vector<Element> results(outputs.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        Element result(tables->length_term);
+        for (size_t k = 0; k < 2; ++k) {
+            const uint256_t scalar(inputs[2 * i + k]);
+            const auto& table = tables->generator_tables[k];
+            for (size_t j = 0; j < Tables::NUM_WINDOWS; ++j) {
+                const size_t bit = j * Tables::WINDOW_BITS;
+                const auto digit = static_cast<size_t>((scalar.data[bit / 64] >> (bit % 64)) & Tables::WINDOW_MASK);
+                if (digit != 0) {
+                    result += table[j * Tables::WINDOW_ENTRIES + digit - 1];
+                }
+            }
+        }
+        results[i] = result;
+    }
+    Element::batch_normalize(results.data(), results.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        outputs[i] = results[i].x;
+    }
+}
+
 template class pedersen_hash_base<curve::Grumpkin>;
 } // namespace bb::crypto
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <memory>
+#include <span>
 namespace bb::crypto {
 /**
  * @brief Performs pedersen hashes!
@@ -31,8 +33,11 @@ template <typename Curve> class pedersen_hash_base {
     inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
+    static void hash_pairs(std::span<const Fq> inputs, std::span<Fq> outputs, GeneratorContext context = {});
 
   private:
+    struct PairTables;
+    static std::shared_ptr<const PairTables> get_pair_tables(const GeneratorContext& context);
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
 };
 
@@ -1,5 +1,6 @@
 #include "pedersen.hpp"
 #include "barretenberg/crypto/generators/generator_data.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include <gtest/gtest.h>
 
@@ -21,4 +22,46 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
+TEST(Pedersen, HashPairs)
+{
+    auto& engine = numeric::get_debug_randomness();
+    const size_t num_pairs = 37;
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    inputs[0] = fr::zero();
+    inputs[3] = -fr::one();
+
+    for (const size_t hash_index : { 0UL, 5UL }) {
+        std::vector<fr> outputs(num_pairs);
+        pedersen_hash::hash_pairs(inputs, outputs, hash_index);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            EXPECT_EQ(outputs[i], pedersen_hash::hash({ inputs[2 * i], inputs[2 * i + 1] }, hash_index));
+        }
+    }
+}
+
+TEST(Pedersen, HashPairsWithOtherGeneratorData)
+{
+    auto& engine = numeric::get_debug_randomness();
+    const size_t num_pairs = 5;
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+
+    // Build the shared tables of the default generator data for this domain separator and offset first
+    GeneratorContext<curve::Grumpkin> context(3, "pedersen_hash_pairs_test");
+    std::vector<fr> outputs(num_pairs);
+    pedersen_hash::hash_pairs(inputs, outputs, context);
+
+    generator_data<curve::Grumpkin> generators;
+    context.generators = &generators;
+    pedersen_hash::hash_pairs(inputs, outputs, context);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        EXPECT_EQ(outputs[i], pedersen_hash::hash({ inputs[2 * i], inputs[2 * i + 1] }, context));
+    }
+}
+
 } // namespace bb::crypto
\ No newline at end of file
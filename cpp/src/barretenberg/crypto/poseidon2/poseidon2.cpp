@@ -1,4 +1,5 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -43,5 +44,36 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash_buffer(const std::vector<
     return hash(converted);
 }
 
+/**
+ * @brief Hashes each consecutive pair of inputs, i.e. outputs[i] = hash({ inputs[2i], inputs[2i + 1] })
+ * @details A fixed length hash of two elements absorbs both into the rate and permutes once (see
+ * FieldSponge::hash_internal), so each hash is a single permutation and these are batched.
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const typename Poseidon2<Params>::FF> inputs,
+                                   std::span<typename Poseidon2<Params>::FF> outputs)
+{
+    ASSERT(inputs.size() == 2 * outputs.size());
+    constexpr size_t rate = Params::t - 1;
+    const FF iv = static_cast<uint256_t>(2) << 64;
+
+    constexpr size_t BATCH_SIZE = 64;
+    std::array<typename Permutation::State, BATCH_SIZE> states;
+    for (size_t start = 0; start < outputs.size(); start += BATCH_SIZE) {
+        const size_t num_states = std::min(BATCH_SIZE, outputs.size() - start);
+        for (size_t i = 0; i < num_states; ++i) {
+            auto& state = states[i];
+            state.fill(FF(0));
+            state[0] = inputs[2 * (start + i)];
+            state[1] = inputs[2 * (start + i) + 1];
+            state[rate] = iv;
+        }
+        Permutation::batch_permutation(std::span(states.data(), num_states));
+        for (size_t i = 0; i < num_states; ++i) {
+            outputs[start + i] = states[i][0];
+        }
+    }
+}
+
 template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 } // namespace bb::crypto
\ No newline at end of file
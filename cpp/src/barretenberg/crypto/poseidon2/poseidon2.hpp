@@ -9,9 +9,10 @@ namespace bb::crypto {
 template <typename Params> class Poseidon2 {
   public:
     using FF = typename Params::FF;
+    using Permutation = Poseidon2Permutation<Params>;
 
     // We choose our rate to be t-1 and capacity to be 1.
-    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Poseidon2Permutation<Params>>;
+    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Permutation>;
 
     /**
      * @brief Hashes a vector of field elements
@@ -22,6 +23,11 @@ template <typename Params> class Poseidon2 {
      * @details Slice function cuts out the required number of bytes from the byte vector
      */
     static FF hash_buffer(const std::vector<uint8_t>& input);
+    /**
+     * @brief Hashes each consecutive pair of inputs, i.e. outputs[i] = hash({ inputs[2i], inputs[2i + 1] })
+     * @details The permutations of the pairs are batched, see Poseidon2Permutation::batch_permutation
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
 };
 
 extern template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
@@ -9,6 +9,23 @@ namespace {
 auto& engine = numeric::get_debug_randomness();
 }
 
+TEST(Poseidon2, HashPairs)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    const size_t num_pairs = 77;
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    std::vector<fr> outputs(num_pairs);
+    Poseidon2::hash_pairs(inputs, outputs);
+
+    for (size_t i = 0; i < num_pairs; ++i) {
+        EXPECT_EQ(outputs[i], Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] }));
+    }
+}
+
 TEST(Poseidon2, HashBasicTests)
 {
 
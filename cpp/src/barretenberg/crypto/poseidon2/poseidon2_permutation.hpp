@@ -7,6 +7,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -43,7 +44,62 @@ template <typename Params> class Poseidon2Permutation {
     static constexpr MatrixDiagonal internal_matrix_diagonal = Params::internal_matrix_diagonal;
     static constexpr RoundConstantsContainer round_constants = Params::round_constants;
 
-    static constexpr void matrix_multiplication_4x4(State& input)
+    // Number of independent states permuted together by batch_permutation
+    static constexpr size_t NUM_LANES = 4;
+
+    /**
+     * @brief The same state element of NUM_LANES independent states, with arithmetic applied lane by lane
+     * @details Running the permutation over a state of Lanes interleaves NUM_LANES permutations, so that the field
+     * multiplications of different lanes, which do not depend on each other, overlap in the pipeline.
+     */
+    struct Lanes {
+        std::array<FF, NUM_LANES> values;
+
+        constexpr Lanes operator+(const Lanes& other) const
+        {
+            Lanes result(*this);
+            result += other;
+            return result;
+        }
+        constexpr Lanes& operator+=(const Lanes& other)
+        {
+            for (size_t i = 0; i < NUM_LANES; ++i) {
+                values[i] += other.values[i];
+            }
+            return *this;
+        }
+        constexpr Lanes& operator+=(const FF& other)
+        {
+            for (auto& value : values) {
+                value += other;
+            }
+            return *this;
+        }
+        constexpr Lanes& operator*=(const Lanes& other)
+        {
+            for (size_t i = 0; i < NUM_LANES; ++i) {
+                values[i] *= other.values[i];
+            }
+            return *this;
+        }
+        constexpr Lanes& operator*=(const FF& other)
+        {
+            for (auto& value : values) {
+                value *= other;
+            }
+            return *this;
+        }
+        constexpr Lanes sqr() const
+        {
+            Lanes result;
+            for (size_t i = 0; i < NUM_LANES; ++i) {
+                result.values[i] = values[i].sqr();
+            }
+            return result;
+        }
+    };
+
+    template <typename T> static constexpr void matrix_multiplication_4x4(std::array<T, t>& input)
     {
         /**
          * hardcoded algorithm that evaluates matrix multiplication using the following MDS matrix:
@@ -76,14 +132,14 @@ template <typename Params> class Poseidon2Permutation {
         input[3] = t4;
     }
 
-    static constexpr void add_round_constants(State& input, const RoundConstants& rc)
+    template <typename T> static constexpr void add_round_constants(std::array<T, t>& input, const RoundConstants& rc)
     {
         for (size_t i = 0; i < t; ++i) {
             input[i] += rc[i];
         }
     }
 
-    static constexpr void matrix_multiplication_internal(State& input)
+    template <typename T> static constexpr void matrix_multiplication_internal(std::array<T, t>& input)
     {
         // for t = 4
         auto sum = input[0];
@@ -96,7 +152,7 @@ template <typename Params> class Poseidon2Permutation {
         }
     }
 
-    static constexpr void matrix_multiplication_external(State& input)
+    template <typename T> static constexpr void matrix_multiplication_external(std::array<T, t>& input)
     {
         if constexpr (t == 4) {
             matrix_multiplication_4x4(input);
@@ -106,7 +162,7 @@ template <typename Params> class Poseidon2Permutation {
         }
     }
 
-    static constexpr void apply_single_sbox(FF& input)
+    template <typename T> static constexpr void apply_single_sbox(T& input)
     {
         // hardcoded assumption that d = 5. should fix this or not make d configurable
         auto xx = input.sqr();
@@ -114,7 +170,7 @@ template <typename Params> class Poseidon2Permutation {
         input *= xxxx;
     }
 
-    static constexpr void apply_sbox(State& input)
+    template <typename T> static constexpr void apply_sbox(std::array<T, t>& input)
     {
         for (auto& in : input) {
             apply_single_sbox(in);
@@ -132,7 +188,40 @@ template <typename Params> class Poseidon2Permutation {
     {
         // deep copy
         State current_state(input);
+        permute_in_place(current_state);
+        return current_state;
+    }
+
+    /**
+     * @brief Applies the permutation to each of the given states, in place
+     * @details The states are permuted NUM_LANES at a time, interleaved element by element (see Lanes). Any remaining
+     * states are permuted one by one.
+     */
+    static void batch_permutation(std::span<State> states)
+    {
+        size_t i = 0;
+        for (; i + NUM_LANES <= states.size(); i += NUM_LANES) {
+            std::array<Lanes, t> lanes;
+            for (size_t j = 0; j < t; ++j) {
+                for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+                    lanes[j].values[lane] = states[i + lane][j];
+                }
+            }
+            permute_in_place(lanes);
+            for (size_t j = 0; j < t; ++j) {
+                for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+                    states[i + lane][j] = lanes[j].values[lane];
+                }
+            }
+        }
+        for (; i < states.size(); ++i) {
+            states[i] = permutation(states[i]);
+        }
+    }
 
+  private:
+    template <typename T> static constexpr void permute_in_place(std::array<T, t>& current_state)
+    {
         // Apply 1st linear layer
         matrix_multiplication_external(current_state);
 
@@ -158,7 +247,6 @@ template <typename Params> class Poseidon2Permutation {
             apply_sbox(current_state);
             matrix_multiplication_external(current_state);
         }
-        return current_state;
     }
 };
 } // namespace bb::crypto
\ No newline at end of file
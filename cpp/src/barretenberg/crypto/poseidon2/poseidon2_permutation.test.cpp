@@ -59,3 +59,23 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, BatchPermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Two full groups of lanes and a remainder permuted one by one
+    std::vector<Permutation::State> states(2 * Permutation::NUM_LANES + 3);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    std::vector<Permutation::State> expected(states.size());
+    for (size_t i = 0; i < states.size(); ++i) {
+        expected[i] = Permutation::permutation(states[i]);
+    }
+
+    Permutation::batch_permutation(states);
+    EXPECT_EQ(states, expected);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <span>
+
+namespace bb {
+
+// Each chunk costs one inversion, worth some 300 multiplications, against 3 multiplications per element
+constexpr size_t MIN_BATCH_INVERT_CHUNK_SIZE = 1024;
+
+/**
+ * @brief Invert every nonzero element of `coeffs` in place, leaving zeros as they are
+ *
+ * @details Splits `coeffs` into one chunk per thread and applies FF::batch_invert (Montgomery's trick) to each, so the
+ * whole span costs one inversion per chunk. As in FF::batch_invert, zeros are skipped, so a chunk may hold only zeros.
+ */
+template <typename FF> void parallel_batch_invert(std::span<FF> coeffs)
+{
+    const size_t num_threads = calculate_num_threads(coeffs.size(), MIN_BATCH_INVERT_CHUNK_SIZE);
+    const size_t chunk_size = (coeffs.size() + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * chunk_size, coeffs.size());
+        const size_t end = std::min(start + chunk_size, coeffs.size());
+        FF::batch_invert(coeffs.subspan(start, end - start));
+    });
+}
+
+} // namespace bb
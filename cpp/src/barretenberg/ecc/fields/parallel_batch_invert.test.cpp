@@ -0,0 +1,36 @@
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+TEST(ParallelBatchInvert, MatchesInvert)
+{
+    // Large enough to be split across threads, with a ragged last chunk
+    const size_t n = 5 * MIN_BATCH_INVERT_CHUNK_SIZE + 17;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = i % 7 == 0 ? fr::zero() : fr::random_element();
+    }
+    // Split across several threads, the first chunk holds only zeros
+    const auto num_zeros = static_cast<std::ptrdiff_t>(2 * MIN_BATCH_INVERT_CHUNK_SIZE);
+    std::fill(coeffs.begin(), coeffs.begin() + num_zeros, fr::zero());
+    std::vector<fr> inverses = coeffs;
+
+    parallel_batch_invert(std::span{ inverses });
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_TRUE(inverses[i].is_zero());
+        } else {
+            EXPECT_EQ(inverses[i], coeffs[i].invert());
+        }
+    }
+}
+
+TEST(ParallelBatchInvert, Empty)
+{
+    std::vector<fr> coeffs;
+    parallel_batch_invert(std::span{ coeffs });
+    EXPECT_TRUE(coeffs.empty());
+}
@@ -0,0 +1,212 @@
+#include "runtime_state_pool.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <limits>
+#include <list>
+#include <map>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace {
+
+using namespace bb;
+using namespace bb::scalar_multiplication;
+
+// As with the slab allocator, runtime states may be released after the pool has been destroyed (e.g. by globals).
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+bool pool_destroyed = false;
+
+// Idle runtime states of one curve, keyed by size class, i.e. the number of points they were allocated for
+template <typename Curve>
+using IdleStates = std::map<size_t, std::list<std::unique_ptr<pippenger_runtime_state<Curve>>>>;
+
+class RuntimeStatePool {
+  public:
+    RuntimeStatePool() = default;
+    RuntimeStatePool(const RuntimeStatePool& other) = delete;
+    RuntimeStatePool(RuntimeStatePool&& other) = delete;
+    RuntimeStatePool& operator=(const RuntimeStatePool& other) = delete;
+    RuntimeStatePool& operator=(RuntimeStatePool&& other) = delete;
+    ~RuntimeStatePool() { pool_destroyed = true; }
+
+    template <typename Curve> std::shared_ptr<pippenger_runtime_state<Curve>> get(size_t num_points);
+
+    void set_memory_limit(size_t max_bytes);
+
+    size_t get_memory_usage();
+
+    void clear();
+
+  private:
+    IdleStates<curve::BN254> bn254_states;
+    IdleStates<curve::Grumpkin> grumpkin_states;
+    size_t memory_limit = std::numeric_limits<size_t>::max();
+    // Bytes of all states handed out by the pool that have not been freed, in use or idle
+    size_t memory_usage = 0;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+
+    template <typename Curve> IdleStates<Curve>& get_idle_states()
+    {
+        if constexpr (std::is_same_v<Curve, curve::BN254>) {
+            return bn254_states;
+        } else {
+            return grumpkin_states;
+        }
+    }
+
+    template <typename Curve> void release(pippenger_runtime_state<Curve>* state, size_t size_class);
+
+    bool evict_largest();
+};
+
+template <typename Curve>
+std::shared_ptr<pippenger_runtime_state<Curve>> RuntimeStatePool::get(const size_t num_points)
+{
+    using State = pippenger_runtime_state<Curve>;
+    size_t size_class = 1UL << numeric::get_msb(std::max<size_t>(num_points, 1));
+    if (size_class < num_points) {
+        size_class <<= 1;
+    }
+    const auto make_shared = [this](State* state, size_t size_class) {
+        return std::shared_ptr<State>(state, [this, size_class](State* released_state) {
+            if (pool_destroyed) {
+                delete released_state;
+                return;
+            }
+            release(released_state, size_class);
+        });
+    };
+
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        auto& idle_states = get_idle_states<Curve>();
+        auto it = idle_states.lower_bound(size_class);
+        // Can use an idle state of up to twice the requested size.
+        if (it != idle_states.end() && it->first <= size_class * 2) {
+            State* state = it->second.back().release();
+            const size_t reused_size_class = it->first;
+            it->second.pop_back();
+            if (it->second.empty()) {
+                idle_states.erase(it);
+            }
+            return make_shared(state, reused_size_class);
+        }
+
+        // Make room for the new state, if needed and possible
+        const size_t num_bytes = State::get_memory_size(size_class);
+        while (memory_usage + num_bytes > memory_limit && evict_largest()) {
+        }
+        memory_usage += num_bytes;
+    }
+    // Allocating (and zeroing) the state is expensive, so it is done without holding the lock
+    return make_shared(new State(size_class), size_class);
+}
+
+template <typename Curve> void RuntimeStatePool::release(pippenger_runtime_state<Curve>* state, const size_t size_class)
+{
+    std::unique_ptr<pippenger_runtime_state<Curve>> owned_state(state);
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    if (memory_usage > memory_limit) {
+        memory_usage -= pippenger_runtime_state<Curve>::get_memory_size(size_class);
+        return;
+    }
+    get_idle_states<Curve>()[size_class].push_back(std::move(owned_state));
+}
+
+/**
+ * Frees the idle state taking up the most memory. Returns false if there is no idle state.
+ */
+bool RuntimeStatePool::evict_largest()
+{
+    const auto largest_size = [](const auto& idle_states) {
+        using State = typename std::remove_cvref_t<decltype(idle_states)>::mapped_type::value_type::element_type;
+        return idle_states.empty() ? 0 : State::get_memory_size(idle_states.rbegin()->first);
+    };
+    const size_t bn254_bytes = largest_size(bn254_states);
+    const size_t grumpkin_bytes = largest_size(grumpkin_states);
+    if (bn254_bytes == 0 && grumpkin_bytes == 0) {
+        return false;
+    }
+    const auto evict = [this](auto& idle_states, size_t num_bytes) {
+        auto it = std::prev(idle_states.end());
+        it->second.pop_back();
+        if (it->second.empty()) {
+            idle_states.erase(it);
+        }
+        memory_usage -= num_bytes;
+    };
+    if (bn254_bytes >= grumpkin_bytes) {
+        evict(bn254_states, bn254_bytes);
+    } else {
+        evict(grumpkin_states, grumpkin_bytes);
+    }
+    return true;
+}
+
+void RuntimeStatePool::set_memory_limit(const size_t max_bytes)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    memory_limit = max_bytes;
+    while (memory_usage > memory_limit && evict_largest()) {
+    }
+}
+
+size_t RuntimeStatePool::get_memory_usage()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    return memory_usage;
+}
+
+void RuntimeStatePool::clear()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    while (evict_largest()) {
+    }
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+RuntimeStatePool pool;
+} // namespace
+
+namespace bb::scalar_multiplication {
+
+template <typename Curve>
+std::shared_ptr<pippenger_runtime_state<Curve>> get_pippenger_runtime_state(const size_t num_points)
+{
+    return pool.get<Curve>(num_points);
+}
+
+void set_pippenger_runtime_state_memory_limit(const size_t max_bytes)
+{
+    pool.set_memory_limit(max_bytes);
+}
+
+size_t get_pippenger_runtime_state_memory_usage()
+{
+    return pool.get_memory_usage();
+}
+
+void clear_pippenger_runtime_state_pool()
+{
+    pool.clear();
+}
+
+template std::shared_ptr<pippenger_runtime_state<curve::BN254>> get_pippenger_runtime_state<curve::BN254>(
+    size_t num_points);
+template std::shared_ptr<pippenger_runtime_state<curve::Grumpkin>> get_pippenger_runtime_state<curve::Grumpkin>(
+    size_t num_points);
+
+} // namespace bb::scalar_multiplication
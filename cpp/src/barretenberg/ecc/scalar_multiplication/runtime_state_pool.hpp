@@ -0,0 +1,38 @@
+#pragma once
+
+#include "./runtime_states.hpp"
+#include <cstddef>
+#include <memory>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * A process-wide pool of pippenger scratch space, shared by all commitment keys (and anything else running MSMs).
+ *
+ * Runtime states are handed out in power-of-two size classes, and go back to the pool when the last reference to them
+ * is dropped, so that e.g. consecutive IVC steps or provers reuse scratch space rather than each allocating and
+ * zeroing their own. States are only held for the duration of an MSM (or a batch of them), so the memory in use is
+ * bounded by the number of MSMs running concurrently rather than by the number of live commitment keys.
+ *
+ * Ref counted result so no need to manually release.
+ *
+ * @param num_points The (maximum) number of points of the MSMs the state will be used for
+ */
+template <typename Curve>
+std::shared_ptr<pippenger_runtime_state<Curve>> get_pippenger_runtime_state(size_t num_points);
+
+/**
+ * Caps the memory spent on pippenger scratch space by all runtime states of the pool, whether in use or idle. Idle
+ * states are freed, largest first, to make room for new ones, and states that are released while the pool is over
+ * the limit are freed rather than kept. States in use are never taken away, so if they alone exceed the limit, new
+ * requests are still served. The default is no limit.
+ */
+void set_pippenger_runtime_state_memory_limit(size_t max_bytes);
+
+// The number of bytes of scratch space held by the pool, in use or idle
+size_t get_pippenger_runtime_state_memory_usage();
+
+// Frees all idle runtime states
+void clear_pippenger_runtime_state_pool();
+
+} // namespace bb::scalar_multiplication
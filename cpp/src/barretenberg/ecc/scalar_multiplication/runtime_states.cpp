@@ -179,6 +179,17 @@ affine_product_runtime_state<Curve> pippenger_runtime_state<Curve>::get_affine_p
     return product_state;
 }
 
+template <typename Curve> size_t pippenger_runtime_state<Curve>::get_memory_size(const size_t num_initial_points)
+{
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_buckets = 1UL << get_optimal_bucket_width(num_initial_points);
+    const size_t num_threads = get_num_cpus_pow2();
+    return (num_points * get_num_pippenger_rounds(num_points) + num_threads * 16) * sizeof(uint64_t) +
+           (num_points * 2 + num_threads * 16) * 2 * sizeof(AffineElement) +
+           num_points * (sizeof(AffineElement) + sizeof(bool)) +
+           num_threads * num_buckets * (2 * sizeof(uint32_t) + sizeof(bool)) + MAX_NUM_ROUNDS * sizeof(uint64_t);
+}
+
 template <typename Curve> pippenger_runtime_state<Curve>::~pippenger_runtime_state() noexcept
 {
     if (skew_table != nullptr) {
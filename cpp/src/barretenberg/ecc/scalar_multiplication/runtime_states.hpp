@@ -112,6 +112,9 @@ template <typename Curve> struct pippenger_runtime_state {
     pippenger_runtime_state(pippenger_runtime_state& other) = delete;
 
     affine_product_runtime_state<Curve> get_affine_product_runtime_state(size_t num_threads, size_t thread_index);
+
+    // The number of bytes of scratch space allocated by the constructor
+    static size_t get_memory_size(size_t num_initial_points);
 };
 
 } // namespace bb::scalar_multiplication
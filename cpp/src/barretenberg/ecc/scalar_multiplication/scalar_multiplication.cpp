@@ -1,19 +1,26 @@
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "./point_table.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
 
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/numeric/bitop/pow.hpp"
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
 
@@ -946,6 +953,215 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
     return pippenger(scalars, points, num_initial_points, state, false);
 }
 
+/**
+ * @brief Whether enough of the scalars are small (less than 2^SMALL_SCALAR_BITS, including zero) for
+ * `pippenger_unsafe_sparse` to pay off
+ *
+ * @details This is the case for many structured polynomials, e.g. selectors, read counts, databus columns or wires
+ * with unused rows.
+ */
+template <typename Curve>
+bool has_many_small_scalars(const typename Curve::ScalarField* scalars, const size_t num_initial_points)
+{
+    std::atomic<size_t> num_small_scalars = 0;
+    run_loop_in_parallel(num_initial_points, [&](size_t start, size_t end) {
+        size_t count = 0;
+        for (size_t i = start; i < end; ++i) {
+            count += static_cast<size_t>(is_small_scalar(scalars[i].from_montgomery_form()));
+        }
+        num_small_scalars += count;
+    });
+    // Below about two thirds the savings do not make up for pippenger being run on a compacted input whose size is
+    // generally not a power of two, i.e. in several passes
+    return num_small_scalars * 3 >= num_initial_points * 2;
+}
+
+/**
+ * @brief Computes an MSM, treating small scalars separately from the rest, see `pippenger_unsafe`
+ *
+ * @details Pippenger costs the same for every scalar: the wnaf representation has no zero digits, so every point is
+ * added into a bucket in every round. Here points with a zero scalar are skipped, points with a small scalar k are
+ * added into bucket k with a single mixed addition (the buckets are then combined with a running sum), and only the
+ * points with the remaining scalars are copied into a compacted point table and fed through pippenger.
+ *
+ * @param scalars The scalars, of which a good part should be small, see `has_many_small_scalars`
+ * @param points The pippenger point table of the bases
+ * @param num_initial_points The number of points before the endomorphism split
+ * @param state Scratch space for at least num_initial_points points
+ */
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_sparse(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                const size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TRACK();
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    constexpr size_t NUM_SMALL_BUCKETS = 1UL << SMALL_SCALAR_BITS;
+
+    const size_t num_chunks = std::max<size_t>(1, std::min(get_num_cpus(), num_initial_points));
+    const size_t chunk_size = (num_initial_points + num_chunks - 1) / num_chunks;
+
+    // Bucket the points with small scalars per chunk, recording the positions of the other scalars
+    std::vector<Element> small_scalar_sums(num_chunks);
+    std::vector<std::vector<uint32_t>> large_scalar_indices(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = std::min(chunk * chunk_size, num_initial_points);
+        const size_t end = std::min(start + chunk_size, num_initial_points);
+        std::vector<Element> buckets(NUM_SMALL_BUCKETS);
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+        uint64_t max_small_scalar = 0;
+        for (size_t i = start; i < end; ++i) {
+            const Fr scalar = scalars[i].from_montgomery_form();
+            if (!is_small_scalar(scalar)) {
+                large_scalar_indices[chunk].push_back(static_cast<uint32_t>(i));
+            } else if (scalar.data[0] != 0) {
+                buckets[scalar.data[0]] += points[i * 2];
+                max_small_scalar = std::max(max_small_scalar, scalar.data[0]);
+            }
+        }
+
+        // ∑ k⋅buckets[k] = ∑ₖ ∑_{j ≥ k} buckets[j]
+        Element running_sum;
+        Element accumulator;
+        running_sum.self_set_infinity();
+        accumulator.self_set_infinity();
+        for (size_t k = max_small_scalar; k > 0; --k) {
+            running_sum += buckets[k];
+            accumulator += running_sum;
+        }
+        small_scalar_sums[chunk] = accumulator;
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (const auto& sum : small_scalar_sums) {
+        result += sum;
+    }
+
+    std::vector<size_t> offsets(num_chunks + 1, 0);
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        offsets[chunk + 1] = offsets[chunk] + large_scalar_indices[chunk].size();
+    }
+    const size_t num_large_scalars = offsets[num_chunks];
+    if (num_large_scalars == 0) {
+        return result;
+    }
+
+    std::vector<Fr> large_scalars(num_large_scalars);
+    auto large_scalar_points = point_table_alloc<AffineElement>(num_large_scalars);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        size_t offset = offsets[chunk];
+        for (const uint32_t i : large_scalar_indices[chunk]) {
+            large_scalars[offset] = scalars[i];
+            large_scalar_points.get()[offset * 2] = points[static_cast<size_t>(i) * 2];
+            large_scalar_points.get()[offset * 2 + 1] = points[static_cast<size_t>(i) * 2 + 1];
+            ++offset;
+        }
+    });
+    result += pippenger_unsafe<Curve>(large_scalars.data(), large_scalar_points.get(), num_large_scalars, state);
+    return result;
+}
+
+/**
+ * @brief Computes several MSMs of the same size against the same points, see `pippenger_unsafe`
+ *
+ * @details Each MSM on its own synchronizes all threads a number of times for little work: the bucket sort, for
+ * instance, only has one task per pippenger round (e.g. 10 for 2^16 points) to share out among the threads. Here the
+ * wnaf computation and the bucket sort of a group of MSMs each run as a single parallel pass over all of their scalar
+ * vectors, after which the bucket accumulation of the group reuses the scratch space of `state` one MSM at a time. The
+ * per-MSM schedules are allocated once per call; the group size is bounded so they take at most
+ * MAX_BATCH_SCHEDULE_BYTES.
+ *
+ * Inputs that pippenger would not process in a single pass (few points, or a number of points that is not a power of
+ * two) are computed by `pippenger_unsafe` one at a time.
+ *
+ * @param scalars The scalar vectors, each of size num_initial_points
+ * @param points The pippenger point table of the bases
+ * @param num_initial_points The number of points before the endomorphism split
+ * @param state Scratch space for at least num_initial_points points
+ * @return The result of each MSM, in the order of the scalar vectors
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_unsafe_batch(std::span<typename Curve::ScalarField* const> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            const size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TRACK();
+    constexpr size_t MAX_BATCH_SCHEDULE_BYTES = 1UL << 28;
+    constexpr size_t MAX_BATCH_SIZE = 8;
+
+    std::vector<typename Curve::Element> results(scalars.size());
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    const bool is_single_pass = num_initial_points > threshold && numeric::is_power_of_two(num_initial_points);
+    if (scalars.size() < 2 || !is_single_pass) {
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            results[i] = pippenger_unsafe<Curve>(scalars[i], points, num_initial_points, state);
+        }
+        return results;
+    }
+
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_rounds = get_num_rounds(num_points);
+    const auto wnaf_bits = static_cast<uint32_t>(get_optimal_bucket_width(num_initial_points)) + 1;
+    const size_t schedule_size = num_points * num_rounds + state.prefetch_overflow;
+    const size_t batch_size =
+        std::clamp(MAX_BATCH_SCHEDULE_BYTES / (schedule_size * sizeof(uint64_t)), 1UL, MAX_BATCH_SIZE);
+
+    // The wnaf schedule, skew table and round counts of each MSM in a group. The first uses those of `state`.
+    struct Schedule {
+        uint64_t* point_schedule;
+        bool* skew_table;
+        uint64_t* round_counts;
+    };
+    std::vector<std::shared_ptr<void>> schedule_slabs;
+    std::vector<std::unique_ptr<bool[]>> skew_tables;
+    std::vector<std::vector<uint64_t>> round_counts;
+    std::vector<Schedule> schedules{ { state.point_schedule, state.skew_table, state.round_counts } };
+    for (size_t i = 1; i < std::min(batch_size, scalars.size()); ++i) {
+        schedule_slabs.push_back(get_mem_slab(schedule_size * sizeof(uint64_t)));
+        skew_tables.push_back(std::make_unique<bool[]>(num_points));
+        round_counts.emplace_back(pippenger_runtime_state<Curve>::MAX_NUM_ROUNDS);
+        schedules.push_back({ static_cast<uint64_t*>(schedule_slabs.back().get()),
+                              skew_tables.back().get(),
+                              round_counts.back().data() });
+    }
+
+    for (size_t start = 0; start < scalars.size(); start += batch_size) {
+        const size_t group_size = std::min(batch_size, scalars.size() - start);
+
+        parallel_for(group_size, [&](size_t i) {
+            compute_wnaf_states<Curve>(schedules[i].point_schedule,
+                                       schedules[i].skew_table,
+                                       schedules[i].round_counts,
+                                       scalars[start + i],
+                                       num_initial_points);
+        });
+        parallel_for(group_size * num_rounds, [&](size_t i) {
+            process_buckets(&schedules[i / num_rounds].point_schedule[(i % num_rounds) * num_points],
+                            num_points,
+                            wnaf_bits);
+        });
+
+        // evaluate_pippenger_rounds reads the schedule through the state, so point it at each schedule in turn
+        for (size_t i = 0; i < group_size; ++i) {
+            state.point_schedule = schedules[i].point_schedule;
+            state.skew_table = schedules[i].skew_table;
+            state.round_counts = schedules[i].round_counts;
+            results[start + i] = evaluate_pippenger_rounds<Curve>(state, points, num_points, false);
+        }
+        state.point_schedule = schedules[0].point_schedule;
+        state.skew_table = schedules[0].skew_table;
+        state.round_counts = schedules[0].round_counts;
+    }
+    return results;
+}
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -1003,6 +1219,20 @@ template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::Scal
                                                               const size_t num_initial_points,
                                                               pippenger_runtime_state<curve::BN254>& state);
 
+template bool has_many_small_scalars<curve::BN254>(const curve::BN254::ScalarField* scalars,
+                                                  const size_t num_initial_points);
+
+template curve::BN254::Element pippenger_unsafe_sparse<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                curve::BN254::AffineElement* points,
+                                                                const size_t num_initial_points,
+                                                                pippenger_runtime_state<curve::BN254>& state);
+
+template std::vector<curve::BN254::Element> pippenger_unsafe_batch<curve::BN254>(
+    std::span<curve::BN254::ScalarField* const> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
     curve::BN254::AffineElement* points,
@@ -1054,6 +1284,20 @@ template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(curve::Grump
                                                                     const size_t num_initial_points,
                                                                     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template bool has_many_small_scalars<curve::Grumpkin>(const curve::Grumpkin::ScalarField* scalars,
+                                                  const size_t num_initial_points);
+
+template curve::Grumpkin::Element pippenger_unsafe_sparse<curve::Grumpkin>(curve::Grumpkin::ScalarField* scalars,
+                                                                curve::Grumpkin::AffineElement* points,
+                                                                const size_t num_initial_points,
+                                                                pippenger_runtime_state<curve::Grumpkin>& state);
+
+template std::vector<curve::Grumpkin::Element> pippenger_unsafe_batch<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField* const> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "./runtime_state_pool.hpp"
 #include "./runtime_states.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 
@@ -164,6 +167,32 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          size_t num_initial_points,
                                          pippenger_runtime_state<Curve>& state);
 
+// Scalars below 2^SMALL_SCALAR_BITS are bucketed directly by pippenger_unsafe_sparse
+constexpr size_t SMALL_SCALAR_BITS = 10;
+
+/**
+ * @brief Whether a scalar, in non-montgomery form, is less than 2^SMALL_SCALAR_BITS
+ */
+template <typename Fr> inline bool is_small_scalar(const Fr& scalar)
+{
+    return (scalar.data[3] | scalar.data[2] | scalar.data[1] | (scalar.data[0] >> SMALL_SCALAR_BITS)) == 0;
+}
+
+template <typename Curve>
+bool has_many_small_scalars(const typename Curve::ScalarField* scalars, size_t num_initial_points);
+
+template <typename Curve>
+typename Curve::Element pippenger_unsafe_sparse(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state);
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_unsafe_batch(std::span<typename Curve::ScalarField* const> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state);
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
@@ -59,8 +59,13 @@ template <IsECCVMFlavor Flavor> void ECCVMProver_<Flavor>::execute_wire_commitme
 {
     auto wire_polys = key->get_wires();
     auto labels = commitment_labels.get_wires();
+    std::vector<std::span<const FF>> wires;
+    for (auto& wire : wire_polys) {
+        wires.emplace_back(wire);
+    }
+    auto wire_commitments = commitment_key->batch_commit(wires);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], wire_commitments[idx]);
     }
 }
 
@@ -132,22 +137,19 @@ template <IsECCVMFlavor Flavor> void ECCVMProver_<Flavor>::execute_univariatizat
     std::vector<FF> rhos = gemini::powers_of_rho(rho, NUM_POLYNOMIALS);
 
     // Batch the unshifted polynomials and the to-be-shifted polynomials using ρ
-    Polynomial batched_poly_unshifted(key->circuit_size); // batched unshifted polynomials
-    size_t poly_idx = 0; // TODO(https://github.com/AztecProtocol/barretenberg/issues/391) zip
     ASSERT(prover_polynomials.get_to_be_shifted().size() == prover_polynomials.get_shifted().size());
+    auto unshifted_polynomials = prover_polynomials.get_unshifted();
+    auto to_be_shifted_polynomials = prover_polynomials.get_to_be_shifted();
+    const size_t num_unshifted = unshifted_polynomials.size();
+    ASSERT(num_unshifted + to_be_shifted_polynomials.size() <= rhos.size());
+    std::span<const FF> unshifted_rhos{ rhos.data(), num_unshifted };
+    std::span<const FF> to_be_shifted_rhos{ rhos.data() + num_unshifted, to_be_shifted_polynomials.size() };
 
-    for (auto& unshifted_poly : prover_polynomials.get_unshifted()) {
-        ASSERT(poly_idx < rhos.size());
-        batched_poly_unshifted.add_scaled(unshifted_poly, rhos[poly_idx]);
-        ++poly_idx;
-    }
+    Polynomial batched_poly_unshifted(key->circuit_size); // batched unshifted polynomials
+    batch_linear_combination(unshifted_polynomials, unshifted_rhos, batched_poly_unshifted);
 
     Polynomial batched_poly_to_be_shifted(key->circuit_size); // batched to-be-shifted polynomials
-    for (auto& to_be_shifted_poly : prover_polynomials.get_to_be_shifted()) {
-        ASSERT(poly_idx < rhos.size());
-        batched_poly_to_be_shifted.add_scaled(to_be_shifted_poly, rhos[poly_idx]);
-        ++poly_idx;
-    };
+    batch_linear_combination(to_be_shifted_polynomials, to_be_shifted_rhos, batched_poly_to_be_shifted);
 
     // Compute d-1 polynomials Fold^(i), i = 1, ..., d-1.
     gemini_polynomials = Gemini::compute_gemini_polynomials(
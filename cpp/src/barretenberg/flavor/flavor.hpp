@@ -174,8 +174,14 @@ class VerificationKey_ : public PrecomputedCommitments {
         this->num_public_inputs = proving_key->num_public_inputs;
         this->pub_inputs_offset = proving_key->pub_inputs_offset;
 
-        for (auto [polynomial, commitment] : zip_view(proving_key->get_precomputed_polynomials(), this->get_all())) {
-            commitment = proving_key->commitment_key->commit(polynomial);
+        using FF = typename std::remove_cvref_t<decltype(*proving_key)>::FF;
+        std::vector<std::span<const FF>> precomputed_polynomials;
+        for (auto& polynomial : proving_key->get_precomputed_polynomials()) {
+            precomputed_polynomials.emplace_back(polynomial);
+        }
+        auto commitments = proving_key->commitment_key->batch_commit(precomputed_polynomials);
+        for (auto [commitment, computed] : zip_view(this->get_all(), commitments)) {
+            commitment = computed;
         }
     }
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
 #include <typeinfo>
 
 namespace bb {
@@ -53,8 +54,8 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
         inverse_polynomial[i] = denominator;
     };
 
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    // Rows without a lookup are left at zero, which the batch inversion skips
+    parallel_batch_invert(std::span<FF>(inverse_polynomial));
 }
 
 /**
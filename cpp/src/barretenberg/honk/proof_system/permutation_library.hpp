@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include <typeinfo>
@@ -122,11 +123,11 @@ void compute_permutation_grand_product(const size_t circuit_size,
                 denominator[i] *= denominator_scaling;
             }
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator[start], block_size });
     });
 
+    // Final step: invert denominator
+    parallel_batch_invert(std::span<FF>(denominator));
+
     // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
     auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
     grand_product_polynomial[0] = 0;
@@ -1,10 +1,13 @@
 #pragma once
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "evaluation_domain.hpp"
 #include "polynomial_arithmetic.hpp"
 #include <fstream>
+#include <type_traits>
 
 namespace bb {
 enum class DontZeroMemory { FLAG };
@@ -280,6 +283,48 @@ template <typename Fr> inline std::ostream& operator<<(std::ostream& os, Polynom
               << "]";
 }
 
+/**
+ * @brief Add the linear combination \sum_i scalars[i] * polynomials[i] to out
+ *
+ * @details This is equivalent to calling out.add_scaled(polynomials[i], scalars[i]) for each i, but makes a single
+ * read-modify-write pass over out rather than one per polynomial. The coefficients of out are split among threads, and
+ * each thread walks its range in tiles small enough to stay in cache while every polynomial is added to them.
+ *
+ * @param polynomials A random access container of polynomials, none of them larger than out, e.g. a RefSpan
+ * @param scalars One scalar per polynomial
+ * @param out The polynomial to accumulate into
+ */
+template <typename Fr, typename Polynomials>
+void batch_linear_combination(const Polynomials& polynomials,
+                              std::type_identity_t<std::span<const Fr>> scalars,
+                              Polynomial<Fr>& out)
+{
+    ASSERT(polynomials.size() == scalars.size());
+    // 32 KiB worth of coefficients of out
+    constexpr size_t TILE_SIZE = 1 << 10;
+
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        ASSERT(polynomials[i].size() <= out.size());
+    }
+
+    run_loop_in_parallel(
+        out.size(),
+        [&](size_t start, size_t end) {
+            for (size_t tile_start = start; tile_start < end; tile_start += TILE_SIZE) {
+                const size_t tile_end = std::min(tile_start + TILE_SIZE, end);
+                for (size_t i = 0; i < polynomials.size(); ++i) {
+                    const auto& polynomial = polynomials[i];
+                    const Fr& scalar = scalars[i];
+                    const size_t poly_end = std::min(tile_end, polynomial.size());
+                    for (size_t idx = tile_start; idx < poly_end; ++idx) {
+                        out[idx] += scalar * polynomial[idx];
+                    }
+                }
+            }
+        },
+        /*no_multhreading_if_less_or_equal=*/TILE_SIZE);
+}
+
 using polynomial = Polynomial<bb::fr>;
 
 } // namespace bb
@@ -1,5 +1,6 @@
 #include "polynomial_arithmetic.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/ref_vector.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
@@ -1305,3 +1306,32 @@ TYPED_TEST(PolynomialTests, RightShift)
 
     EXPECT_EQ(shifted_evaluation, shifted_eval_reconstructed);
 }
+
+/**
+ * @brief Test that batch_linear_combination agrees with repeated calls to add_scaled, including for polynomials smaller
+ * than the output and for outputs large enough to be split into several tiles and threads
+ *
+ */
+TYPED_TEST(PolynomialTests, BatchLinearCombination)
+{
+    using FF = TypeParam;
+
+    const size_t num_coeffs = (1 << 13) + 5;
+    const std::array<size_t, 4> sizes = { num_coeffs, 17, 1 << 12, num_coeffs - 1 };
+
+    std::vector<Polynomial<FF>> polynomials;
+    std::vector<FF> scalars;
+    for (size_t size : sizes) {
+        polynomials.emplace_back(Polynomial<FF>::random(size));
+        scalars.emplace_back(FF::random_element());
+    }
+
+    Polynomial<FF> expected = Polynomial<FF>::random(num_coeffs);
+    Polynomial<FF> result(expected);
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        expected.add_scaled(polynomials[i], scalars[i]);
+    }
+    batch_linear_combination(RefVector(polynomials), scalars, result);
+
+    EXPECT_EQ(result, expected);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
 
 namespace bb {
 
@@ -176,7 +177,7 @@ template <typename Flavor> class ECCVMTranscriptBuilder {
             }
         }
 
-        FF::batch_invert(&inverse_trace[0], inverse_trace.size());
+        parallel_batch_invert(std::span{ inverse_trace });
         for (size_t i = 0; i < inverse_trace.size(); ++i) {
             transcript_state[i + 1].collision_check = inverse_trace[i];
         }
@@ -607,16 +607,17 @@ uint32_t UltraCircuitBuilder_<Arithmetization>::put_constant_variable(const FF&
 }
 
 template <typename Arithmetization>
-plookup::BasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
+plookup::CircuitBasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
 {
-    for (plookup::BasicTable& table : lookup_tables) {
-        if (table.id == id) {
-            return table;
-        }
-    }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
-    return lookup_tables[lookup_tables.size() - 1];
+    auto it = lookup_table_positions.find(id);
+    if (it != lookup_table_positions.end()) {
+        return lookup_tables[it->second];
+    }
+    // Table isn't used yet! So add the shared table, creating it if need be.
+    const size_t table_index = lookup_tables.size();
+    lookup_table_positions.emplace(id, table_index);
+    lookup_tables.push_back({ .data = plookup::get_basic_table(id), .table_index = table_index, .lookup_gates = {} });
+    return lookup_tables.back();
 }
 
 /**
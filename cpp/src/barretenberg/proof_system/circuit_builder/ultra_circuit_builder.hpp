@@ -9,6 +9,7 @@
 #include "barretenberg/proof_system/types/pedersen_commitment_type.hpp"
 #include "circuit_builder_base.hpp"
 #include <optional>
+#include <unordered_map>
 
 namespace bb {
 
@@ -279,7 +280,9 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
     std::map<FF, uint32_t> constant_variable_indices;
 
-    std::vector<plookup::BasicTable> lookup_tables;
+    std::vector<plookup::CircuitBasicTable> lookup_tables;
+    // The position in lookup_tables of each table used by the circuit, which is also its table_index
+    std::unordered_map<plookup::BasicTableId, size_t> lookup_table_positions;
     std::vector<plookup::MultiTable> lookup_multi_tables;
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
@@ -365,6 +368,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         constant_variable_indices = other.constant_variable_indices;
 
         lookup_tables = other.lookup_tables;
+        lookup_table_positions = other.lookup_table_positions;
         lookup_multi_tables = other.lookup_multi_tables;
         range_lists = other.range_lists;
         ram_arrays = other.ram_arrays;
@@ -382,6 +386,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         constant_variable_indices = other.constant_variable_indices;
 
         lookup_tables = other.lookup_tables;
+        lookup_table_positions = other.lookup_table_positions;
         lookup_multi_tables = other.lookup_multi_tables;
         range_lists = other.range_lists;
         ram_arrays = other.ram_arrays;
@@ -613,7 +618,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     {
         size_t tables_size = 0;
         for (const auto& table : lookup_tables) {
-            tables_size += table.size;
+            tables_size += table.data->size;
         }
         return tables_size;
     }
@@ -683,7 +688,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
                                       bool (*generator)(std::vector<FF>&, std::vector<FF>&, std::vector<FF>&),
                                       std::array<FF, 2> (*get_values_from_key)(const std::array<uint64_t, 2>));
 
-    plookup::BasicTable& get_table(const plookup::BasicTableId id);
+    plookup::CircuitBasicTable& get_table(const plookup::BasicTableId id);
     plookup::MultiTable& create_table(const plookup::MultiTableId id);
 
     plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/proof_system/plookup_tables/types.hpp"
 #include "barretenberg/proof_system/polynomial_store/polynomial_store.hpp"
 
 #include <memory>
@@ -28,10 +29,11 @@ std::array<typename Flavor::Polynomial, 4> construct_lookup_table_polynomials(
     for (const auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
 
-        for (size_t i = 0; i < table.size; ++i) {
-            table_polynomials[0][offset] = table.column_1[i];
-            table_polynomials[1][offset] = table.column_2[i];
-            table_polynomials[2][offset] = table.column_3[i];
+        const auto& data = *table.data;
+        for (size_t i = 0; i < data.size; ++i) {
+            table_polynomials[0][offset] = data.column_1[i];
+            table_polynomials[1][offset] = data.column_2[i];
+            table_polynomials[2][offset] = data.column_3[i];
             table_polynomials[3][offset] = table_index;
             ++offset;
         }
@@ -49,9 +51,8 @@ std::array<typename Flavor::Polynomial, 4> construct_lookup_table_polynomials(
  * @return std::array<typename Flavor::Polynomial, 4>
  */
 template <typename Flavor>
-std::array<typename Flavor::Polynomial, 4> construct_sorted_list_polynomials(typename Flavor::CircuitBuilder& circuit,
-                                                                             const size_t dyadic_circuit_size,
-                                                                             size_t additional_offset = 0)
+std::array<typename Flavor::Polynomial, 4> construct_sorted_list_polynomials(
+    const typename Flavor::CircuitBuilder& circuit, const size_t dyadic_circuit_size, size_t additional_offset = 0)
 {
     using Polynomial = typename Flavor::Polynomial;
     std::array<Polynomial, 4> sorted_polynomials;
@@ -67,43 +68,34 @@ std::array<typename Flavor::Polynomial, 4> construct_sorted_list_polynomials(typ
     size_t s_index = dyadic_circuit_size - (circuit.get_tables_size() + circuit.get_lookups_size()) - additional_offset;
     ASSERT(s_index > 0); // We need at least 1 row of zeroes for the permutation argument
 
-    for (auto& table : circuit.lookup_tables) {
+    for (const auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
-        auto& lookup_gates = table.lookup_gates;
-        for (size_t i = 0; i < table.size; ++i) {
-            if (table.use_twin_keys) {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
-                    },
-                    {
-                        table.column_3[i],
-                        0,
-                    },
-                });
+        const auto& data = *table.data;
+        ASSERT(data.row_index.size() == data.size); // The table must have been indexed by get_basic_table
+
+        // The table rows are sorted by key, so the sorted list is each row followed by every lookup reading it. Lookups
+        // whose key is not in the table can not satisfy the lookup argument, and are placed after the table rows.
+        std::vector<uint32_t> read_counts(data.size, 0);
+        std::vector<const plookup::BasicTable::KeyEntry*> missing_lookups;
+        for (const auto& entry : table.lookup_gates) {
+            if (const auto row = data.find_row(entry)) {
+                ++read_counts[*row];
             } else {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        0,
-                    },
-                    {
-                        table.column_2[i],
-                        table.column_3[i],
-                    },
-                });
+                missing_lookups.push_back(&entry);
             }
         }
 
-#ifdef NO_TBB
-        std::sort(lookup_gates.begin(), lookup_gates.end());
-#else
-        std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
-#endif
-
-        for (const auto& entry : lookup_gates) {
-            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
+        for (size_t i = 0; i < data.size; ++i) {
+            for (size_t j = 0; j <= read_counts[i]; ++j) {
+                sorted_polynomials[0][s_index] = data.column_1[i];
+                sorted_polynomials[1][s_index] = data.column_2[i];
+                sorted_polynomials[2][s_index] = data.column_3[i];
+                sorted_polynomials[3][s_index] = table_index;
+                ++s_index;
+            }
+        }
+        for (const auto* entry : missing_lookups) {
+            const auto components = entry->to_sorted_list_components(data.use_twin_keys);
             sorted_polynomials[0][s_index] = components[0];
             sorted_polynomials[1][s_index] = components[1];
             sorted_polynomials[2][s_index] = components[2];
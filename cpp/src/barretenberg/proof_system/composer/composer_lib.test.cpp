@@ -3,6 +3,7 @@
 #include "barretenberg/flavor/ultra.hpp"
 #include "barretenberg/proof_system/types/circuit_type.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
+#include "barretenberg/srs/global_crs.hpp"
 #include <array>
 #include <gtest/gtest.h>
 
@@ -12,10 +13,56 @@ class ComposerLibTests : public ::testing::Test {
   protected:
     using Flavor = UltraFlavor;
     using FF = typename Flavor::FF;
+
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+
     Flavor::CircuitBuilder circuit_constructor;
     Flavor::ProvingKey proving_key = []() {
         auto crs_factory = srs::factories::CrsFactory<bb::curve::BN254>();
         auto crs = crs_factory.get_prover_crs(4);
         return Flavor::ProvingKey(/*circuit_size=*/8, /*num_public_inputs=*/0);
     }();
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Check that the sorted list polynomials hold, for each table, its entries and lookups sorted by key
+ */
+TEST_F(ComposerLibTests, ConstructSortedListPolynomials)
+{
+    for (size_t i = 0; i < 8; ++i) {
+        const FF left(i * 0x01020304);
+        const FF right(i * 0x0a0b0c0d);
+        const auto left_index = circuit_constructor.add_variable(left);
+        const auto right_index = circuit_constructor.add_variable(right);
+        const auto accumulators = plookup::get_lookup_accumulators(plookup::MultiTableId::UINT32_XOR, left, right, true);
+        circuit_constructor.create_gates_from_plookup_accumulators(
+            plookup::MultiTableId::UINT32_XOR, accumulators, left_index, right_index);
+    }
+    const size_t num_sorted_entries = circuit_constructor.get_tables_size() + circuit_constructor.get_lookups_size();
+    const size_t dyadic_circuit_size = 1 << 13;
+    ASSERT_LT(num_sorted_entries, dyadic_circuit_size);
+
+    auto sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit_constructor, dyadic_circuit_size);
+
+    size_t s_index = dyadic_circuit_size - num_sorted_entries;
+    for (const auto& table : circuit_constructor.lookup_tables) {
+        const auto& data = *table.data;
+        EXPECT_TRUE(data.use_twin_keys);
+        auto entries = table.lookup_gates;
+        for (size_t i = 0; i < data.size; ++i) {
+            entries.push_back({ { data.column_1[i].from_montgomery_form().data[0],
+                                  data.column_2[i].from_montgomery_form().data[0] },
+                                { data.column_3[i], 0 } });
+        }
+        std::sort(entries.begin(), entries.end());
+        for (const auto& entry : entries) {
+            const auto components = entry.to_sorted_list_components(data.use_twin_keys);
+            EXPECT_EQ(sorted_polynomials[0][s_index], components[0]);
+            EXPECT_EQ(sorted_polynomials[1][s_index], components[1]);
+            EXPECT_EQ(sorted_polynomials[2][s_index], components[2]);
+            EXPECT_EQ(sorted_polynomials[3][s_index], FF(table.table_index));
+            ++s_index;
+        }
+    }
+    EXPECT_EQ(s_index, dyadic_circuit_size);
+}
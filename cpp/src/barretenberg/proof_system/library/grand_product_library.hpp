@@ -2,6 +2,7 @@
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/ecc/fields/parallel_batch_invert.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
@@ -124,11 +125,11 @@ void compute_grand_product(const size_t circuit_size,
                 denominator[i] *= denominator_scaling;
             }
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator[start], block_size });
     });
 
+    // Final step: invert denominator
+    parallel_batch_invert(std::span<FF>(denominator));
+
     // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
     auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
     grand_product_polynomial[0] = 0;
@@ -109,6 +109,12 @@ void init_multi_tables()
     MULTI_TABLES[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
     initialised = true;
 }
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::shared_ptr<const BasicTable>, BasicTableId::NUM_BASIC_TABLES> BASIC_TABLES;
+#ifndef NO_MULTITHREADING
+std::mutex basic_table_mutex;
+#endif
 } // namespace
 const MultiTable& create_table(const MultiTableId id)
 {
@@ -119,6 +125,20 @@ const MultiTable& create_table(const MultiTableId id)
     return MULTI_TABLES[id];
 }
 
+std::shared_ptr<const BasicTable> get_basic_table(const BasicTableId id)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(basic_table_mutex);
+#endif
+    std::shared_ptr<const BasicTable>& table = BASIC_TABLES[id];
+    if (!table) {
+        BasicTable basic_table = create_basic_table(id, 0);
+        basic_table.index_rows();
+        table = std::make_shared<const BasicTable>(std::move(basic_table));
+    }
+    return table;
+}
+
 ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
                                          const fr& key_a,
                                          const fr& key_b,
@@ -20,6 +20,13 @@ namespace bb::plookup {
 
 const MultiTable& create_table(MultiTableId id);
 
+/**
+ * @brief Returns the basic table with the given id, shared by every circuit in the process and generated on first use
+ * @details The returned table has table_index 0 and no lookup gates, see CircuitBasicTable. Its rows are indexed by key,
+ * see BasicTable::index_rows.
+ */
+std::shared_ptr<const BasicTable> get_basic_table(BasicTableId id);
+
 ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_a,
                                          const bb::fr& key_b = 0,
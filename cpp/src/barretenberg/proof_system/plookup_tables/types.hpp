@@ -1,9 +1,13 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 
 namespace bb::plookup {
@@ -73,6 +77,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -300,9 +305,68 @@ struct BasicTable {
 
     std::array<bb::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
 
+    // Hash of a key tuple, the second key being zero unless the table uses twin keys
+    struct RowKeyHash {
+        size_t operator()(const std::array<uint64_t, 2>& key) const
+        {
+            return std::hash<uint64_t>()(key[0] * 0x9e3779b97f4a7c15ULL ^ key[1]);
+        }
+    };
+    // The row holding each key tuple, populated by index_rows
+    std::unordered_map<std::array<uint64_t, 2>, size_t, RowKeyHash> row_index;
+
+    /**
+     * @brief Populates row_index from the table columns
+     * @details The shared tables returned by get_basic_table are indexed when they are created, so that a lookup can be
+     * mapped to the row it reads in constant time. Every key must be held by exactly one row.
+     */
+    void index_rows()
+    {
+        row_index.clear();
+        row_index.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            const uint64_t key_2 = use_twin_keys ? column_2[i].from_montgomery_form().data[0] : 0;
+            [[maybe_unused]] const bool inserted =
+                row_index.emplace(std::array<uint64_t, 2>{ column_1[i].from_montgomery_form().data[0], key_2 }, i)
+                    .second;
+            ASSERT(inserted);
+        }
+    }
+
+    /**
+     * @brief Returns the row holding the key of the given lookup, if the table has been indexed and holds the key
+     */
+    std::optional<size_t> find_row(const KeyEntry& entry) const
+    {
+        const uint256_t key_2 = use_twin_keys ? entry.key[1] : 0;
+        if (entry.key[0].get_msb() >= 64 || key_2.get_msb() >= 64) {
+            return std::nullopt;
+        }
+        auto it = row_index.find({ entry.key[0].data[0], key_2.data[0] });
+        if (it == row_index.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
     bool operator==(const BasicTable& other) const = default;
 };
 
+/**
+ * @brief A basic table used by a circuit
+ *
+ * @details The table data is shared between every circuit using the table and is never modified, see get_basic_table.
+ * The circuit only keeps the index it assigns to the table and the lookups it makes into it, which take the place of
+ * the table_index and lookup_gates of the shared table.
+ */
+struct CircuitBasicTable {
+    std::shared_ptr<const BasicTable> data;
+    size_t table_index;
+    std::vector<BasicTable::KeyEntry> lookup_gates;
+
+    bool operator==(const CircuitBasicTable& other) const = default;
+};
+
 enum ColumnIdx { C1, C2, C3 };
 
 /**
@@ -48,6 +48,30 @@ template <typename Relation, size_t subrelation_index> constexpr bool subrelatio
     }
 }
 
+template <typename T, typename AllEntities>
+concept HasSkipMember = requires(const AllEntities& input) {
+                            {
+                                T::skip(input)
+                                } -> std::same_as<bool>;
+                        };
+
+/**
+ * @brief Check whether the contribution of a relation on the given input is known to be zero, so that its accumulation
+ * can be skipped.
+ *
+ * @details Relations that are gated by a selector define a static method `skip` that cheaply checks whether that
+ * selector vanishes on the input (an edge in sumcheck, a row across all instances in Protogalaxy). Relations without
+ * such a method are never skipped.
+ */
+template <typename Relation, typename AllEntities> bool relation_can_be_skipped(const AllEntities& input)
+{
+    if constexpr (HasSkipMember<Relation, AllEntities>) {
+        return Relation::skip(input);
+    } else {
+        return false;
+    }
+}
+
 /**
  * @brief Compute the total subrelation lengths, i.e., the lengths when regarding the challenges as
  * variables.
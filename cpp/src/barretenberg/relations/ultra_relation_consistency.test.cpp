@@ -678,3 +678,34 @@ TEST_F(UltraRelationConsistency, Poseidon2InternalRelation)
     run_test(/*random_inputs=*/false);
     run_test(/*random_inputs=*/true);
 };
+
+/**
+ * @brief Check that a relation is only skipped on inputs where its selector is zero, and that all of its subrelations
+ * indeed vanish on such inputs
+ *
+ */
+TEST_F(UltraRelationConsistency, SkippedRelationsVanish)
+{
+    const auto run_test = []<typename Relation>(auto get_selector) {
+        using SumcheckArrayOfValuesOverSubrelations = typename Relation::SumcheckArrayOfValuesOverSubrelations;
+        const auto parameters = RelationParameters<FF>::get_random();
+
+        InputElements input_elements = InputElements::get_random();
+        EXPECT_FALSE(Relation::skip(input_elements));
+
+        get_selector(input_elements) = 0;
+        EXPECT_TRUE(Relation::skip(input_elements));
+
+        SumcheckArrayOfValuesOverSubrelations expected_values;
+        std::fill(expected_values.begin(), expected_values.end(), FF(0));
+        validate_relation_execution<Relation>(expected_values, input_elements, parameters);
+    };
+    run_test.template operator()<UltraArithmeticRelation<FF>>([](InputElements& in) -> FF& { return in.q_arith; });
+    run_test.template operator()<GenPermSortRelation<FF>>([](InputElements& in) -> FF& { return in.q_sort; });
+    run_test.template operator()<EllipticRelation<FF>>([](InputElements& in) -> FF& { return in.q_elliptic; });
+    run_test.template operator()<AuxiliaryRelation<FF>>([](InputElements& in) -> FF& { return in.q_aux; });
+    run_test.template operator()<Poseidon2ExternalRelation<FF>>(
+        [](InputElements& in) -> FF& { return in.q_poseidon2_external; });
+    run_test.template operator()<Poseidon2InternalRelation<FF>>(
+        [](InputElements& in) -> FF& { return in.q_poseidon2_internal; });
+};
@@ -47,16 +47,17 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, bool use_point_table_cache)
     : path_(std::move(path))
     , degree_(initial_degree)
+    , use_point_table_cache_(use_point_table_cache)
 {}
 
 template <typename Curve>
 std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
     if (degree != degree_ || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, use_point_table_cache_);
         degree_ = degree;
     }
     return prover_crs_;
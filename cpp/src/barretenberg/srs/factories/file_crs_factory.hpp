@@ -1,5 +1,6 @@
 #pragma once
 #include "../io.hpp"
+#include "../point_table_cache.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
@@ -12,10 +13,12 @@ namespace bb::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ * If use_point_table_cache is set, prover point tables are memory mapped from (and written to) a PointTableCache file
+ * in the same directory, rather than being decoded and expanded from the transcripts by every process.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, bool use_point_table_cache = false);
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -25,19 +28,34 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   private:
     std::string path_;
     size_t degree_;
+    bool use_point_table_cache_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
+    FileProverCrs(const size_t num_points, std::string const& path, bool use_point_table_cache = false)
         : num_points(num_points)
     {
+        using Cache = srs::PointTableCache<Curve>;
+        const std::string cache_path = Cache::get_path(path);
+        const uint64_t source_fingerprint = use_point_table_cache ? get_transcript_fingerprint(path) : 0;
+        if (use_point_table_cache) {
+            monomials_ = Cache::read(cache_path, num_points, source_fingerprint);
+            if (monomials_) {
+                return;
+            }
+        }
+
         monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
 
         srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+
+        if (use_point_table_cache && !Cache::write(cache_path, monomials_.get(), num_points, source_fingerprint)) {
+            info("could not write pippenger point table to ", cache_path);
+        }
     };
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
@@ -45,6 +63,20 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
     [[nodiscard]] size_t get_monomial_size() const { return num_points; }
 
   private:
+    // Fingerprints the transcript files of the directory, which are read in order until one is missing
+    static uint64_t get_transcript_fingerprint(std::string const& path)
+    {
+        std::vector<std::string> transcript_paths;
+        for (size_t num = 0;; ++num) {
+            auto transcript_path = srs::IO<Curve>::get_transcript_path(path, num);
+            if (!std::filesystem::exists(transcript_path)) {
+                break;
+            }
+            transcript_paths.push_back(std::move(transcript_path));
+        }
+        return srs::PointTableCache<Curve>::compute_source_fingerprint(transcript_paths);
+    }
+
     size_t num_points;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
 };
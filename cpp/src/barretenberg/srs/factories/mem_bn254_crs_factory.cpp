@@ -46,6 +46,12 @@ MemBn254CrsFactory::MemBn254CrsFactory(std::vector<g1::affine_element> const& po
     , verifier_crs_(std::make_shared<MemVerifierCrs>(g2_point))
 {}
 
+MemBn254CrsFactory::MemBn254CrsFactory(std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> prover_crs,
+                                       g2::affine_element const& g2_point)
+    : prover_crs_(std::move(prover_crs))
+    , verifier_crs_(std::make_shared<MemVerifierCrs>(g2_point))
+{}
+
 std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> MemBn254CrsFactory::get_prover_crs(size_t)
 {
     return prover_crs_;
@@ -3,6 +3,8 @@
 #include "./factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include "barretenberg/srs/point_table_cache.hpp"
 
 namespace {
 // TODO(#637): As a PoC we have two global variables for the two CRS but this could be improved to avoid duplication.
@@ -18,13 +20,39 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
     crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
 }
 
+// Initializes the crs from a memory mapped pippenger point table, as bb does when asked to cache point tables
+void init_crs_factory(std::string const& point_table_cache_dir,
+                      std::string const& points_path,
+                      size_t num_points,
+                      std::function<std::vector<g1::affine_element>()> const& get_points,
+                      g2::affine_element const g2_point)
+{
+    using Cache = PointTableCache<curve::BN254>;
+    const std::string cache_path = Cache::get_path(point_table_cache_dir);
+
+    std::shared_ptr<factories::ProverCrs<curve::BN254>> prover_crs;
+    if (auto point_table = Cache::read(cache_path, num_points, Cache::compute_source_fingerprint({ points_path }))) {
+        prover_crs = std::make_shared<factories::MemProverCrs<curve::BN254>>(std::move(point_table), num_points);
+    } else {
+        prover_crs = std::make_shared<factories::MemProverCrs<curve::BN254>>(get_points());
+        // get_points() may have (re)downloaded the points, so the fingerprint is taken again
+        if (!Cache::write(cache_path,
+                          prover_crs->get_monomial_points(),
+                          prover_crs->get_monomial_size(),
+                          Cache::compute_source_fingerprint({ points_path }))) {
+            info("could not write pippenger point table to ", cache_path);
+        }
+    }
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(std::move(prover_crs), g2_point);
+}
+
 // Initializes crs from a file path this we use in the entire codebase
-void init_crs_factory(std::string crs_path)
+void init_crs_factory(std::string crs_path, bool use_point_table_cache)
 {
     if (crs_factory != nullptr) {
         return;
     }
-    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, use_point_table_cache);
 }
 
 // Initializes the crs using the memory buffers
@@ -33,12 +61,13 @@ void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const
     grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(points);
 }
 
-void init_grumpkin_crs_factory(std::string crs_path)
+void init_grumpkin_crs_factory(std::string crs_path, bool use_point_table_cache)
 {
     if (grumpkin_crs_factory != nullptr) {
         return;
     }
-    grumpkin_crs_factory = std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path);
+    grumpkin_crs_factory =
+        std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path, 0, use_point_table_cache);
 }
 
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory()
@@ -1,17 +1,28 @@
+#pragma once
 #include "./factories/crs_factory.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <functional>
 
 namespace bb::srs {
 
-// Initializes the crs using files
-void init_crs_factory(std::string crs_path);
-void init_grumpkin_crs_factory(std::string crs_path);
+// Initializes the crs using files, optionally memory mapping prover point tables from a cache in crs_path
+void init_crs_factory(std::string crs_path, bool use_point_table_cache = false);
+void init_grumpkin_crs_factory(std::string crs_path, bool use_point_table_cache = false);
 
 // Initializes the crs using memory buffers
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
 
+// Initializes the crs using a pippenger point table memory mapped from a cache in point_table_cache_dir. On a cache
+// miss, or if the file at points_path changed since the cache was written, the table is built from get_points() (which
+// must read at least num_points points from points_path) and written to the cache.
+void init_crs_factory(std::string const& point_table_cache_dir,
+                      std::string const& points_path,
+                      size_t num_points,
+                      std::function<std::vector<bb::g1::affine_element>()> const& get_points,
+                      bb::g2::affine_element const g2_point);
+
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory();
 std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
 
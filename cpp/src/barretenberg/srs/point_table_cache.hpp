@@ -0,0 +1,252 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs {
+
+/**
+ * @brief The header of an on-disk pippenger point table
+ *
+ * @details The file holds the output of `generate_pippenger_point_table`, i.e. the SRS points interleaved with their
+ * endomorphism images, stored verbatim (montgomery form, native byte order) so that it can be memory mapped and used
+ * by pippenger without any decoding. A prefix of a point table is itself a valid point table, so a single file serves
+ * every degree up to `num_points`. The source fingerprint ties the table to the files its points were read from (see
+ * `compute_source_fingerprint`).
+ *
+ * 00   | XX XX XX XX XX XX XX XX | Magic "BBPTABLE"
+ * 08   | XX XX XX XX             | Format version
+ * 0C   | XX XX XX XX             | sizeof(AffineElement)
+ * 10   | XX XX XX XX XX XX XX XX | First limb of the base field modulus, identifies the curve
+ * 18   | XX XX XX XX XX XX XX XX | The number of SRS points (the table holds twice as many elements)
+ * 20   | XX XX XX XX XX XX XX XX | Checksum of the table data
+ * 28   | XX XX XX XX XX XX XX XX | Fingerprint of the source files of the points
+ * 30   | 00 ...                  | Padding up to TABLE_OFFSET
+ * 40   | XX XX XX XX             | ‾\
+ *            ...                     > 2 * num_points * sizeof(AffineElement) bytes
+ * YY   | XX XX XX XX             | _/
+ */
+struct PointTableCacheHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t curve_tag;
+    uint64_t num_points;
+    uint64_t checksum;
+    uint64_t source_fingerprint;
+};
+
+template <typename Curve> class PointTableCache {
+    using Fq = typename Curve::BaseField;
+    using AffineElement = typename Curve::AffineElement;
+
+    static constexpr std::array<char, 8> MAGIC = { 'B', 'B', 'P', 'T', 'A', 'B', 'L', 'E' };
+    static constexpr uint32_t VERSION = 2;
+    // Keeps the table 64-byte aligned in the mapping (mmap returns page aligned addresses)
+    static constexpr size_t TABLE_OFFSET = 64;
+    static_assert(sizeof(PointTableCacheHeader) <= TABLE_OFFSET);
+
+    static constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+    static size_t get_table_size(size_t num_points) { return 2 * num_points * sizeof(AffineElement); }
+
+    static bool is_header_valid(PointTableCacheHeader const& header)
+    {
+        return header.magic == MAGIC && header.version == VERSION && header.element_size == sizeof(AffineElement) &&
+               header.curve_tag == Fq::modulus.data[0];
+    }
+
+  public:
+    static std::string get_path(std::string const& dir) { return dir + "/pippenger_point_table.dat"; }
+
+    /**
+     * @brief Computes a 64-bit FNV-1a style checksum of the table data
+     *
+     * @details The data is hashed in fixed-size chunks in parallel and the chunk hashes are then combined serially, so
+     * the result does not depend on the number of threads.
+     */
+    static uint64_t compute_checksum(AffineElement const* table, size_t num_points)
+    {
+        constexpr size_t WORDS_PER_CHUNK = (1 << 20) / sizeof(uint64_t);
+
+        const auto* words = reinterpret_cast<uint64_t const*>(table);
+        const size_t num_words = get_table_size(num_points) / sizeof(uint64_t);
+        const size_t num_chunks = (num_words + WORDS_PER_CHUNK - 1) / WORDS_PER_CHUNK;
+
+        std::vector<uint64_t> chunk_hashes(num_chunks);
+        parallel_for(num_chunks, [&](size_t chunk) {
+            const size_t start = chunk * WORDS_PER_CHUNK;
+            const size_t end = std::min(start + WORDS_PER_CHUNK, num_words);
+            uint64_t hash = FNV_OFFSET_BASIS;
+            for (size_t i = start; i < end; ++i) {
+                hash = (hash ^ words[i]) * FNV_PRIME;
+            }
+            chunk_hashes[chunk] = hash;
+        });
+
+        uint64_t hash = FNV_OFFSET_BASIS;
+        for (const auto& chunk_hash : chunk_hashes) {
+            hash = (hash ^ chunk_hash) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Fingerprints the files the points of a table are read from by their sizes and modification times
+     *
+     * @details A table is only served while the fingerprint it was written with still matches, so replacing or
+     * extending the source files (e.g. the transcripts of srs_db) invalidates it. Missing files leave their place in
+     * the fingerprint as if empty.
+     */
+    static uint64_t compute_source_fingerprint(std::vector<std::string> const& source_paths)
+    {
+        uint64_t hash = FNV_OFFSET_BASIS;
+        for (const auto& source_path : source_paths) {
+            uint64_t size = 0;
+            uint64_t mtime = 0;
+            std::error_code ec;
+            if (std::filesystem::is_regular_file(source_path, ec)) {
+                size = static_cast<uint64_t>(std::filesystem::file_size(source_path, ec));
+                mtime = static_cast<uint64_t>(
+                    std::filesystem::last_write_time(source_path, ec).time_since_epoch().count());
+            }
+            hash = (hash ^ size) * FNV_PRIME;
+            hash = (hash ^ mtime) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Maps a point table previously written by `write` into memory, read only
+     *
+     * @details The mapping is shared, so concurrently running provers using the same file share the physical pages
+     * through the page cache. The returned pointer unmaps the file once the last reference is released.
+     *
+     * The whole table is rehashed and checked against the checksum of the header, which is still far cheaper than
+     * decoding and expanding the points it replaces. verify_checksum = false skips that and only checks the header and
+     * the file size.
+     *
+     * @return The table, or nullptr if the file is missing, malformed, corrupted, holds fewer than num_points points or
+     * was written from other source files.
+     */
+    static std::shared_ptr<AffineElement[]> read(std::string const& path,
+                                                 size_t num_points,
+                                                 uint64_t source_fingerprint,
+                                                 bool verify_checksum = true)
+    {
+#ifdef __wasm__
+        static_cast<void>(path);
+        static_cast<void>(num_points);
+        static_cast<void>(source_fingerprint);
+        static_cast<void>(verify_checksum);
+        return nullptr;
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        struct stat st;
+        PointTableCacheHeader header;
+        bool valid = fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= TABLE_OFFSET &&
+                     pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                     is_header_valid(header) && header.num_points >= num_points &&
+                     static_cast<size_t>(st.st_size) == TABLE_OFFSET + get_table_size(header.num_points);
+        if (!valid) {
+            close(fd);
+            info("ignoring malformed pippenger point table at ", path);
+            return nullptr;
+        }
+        if (header.source_fingerprint != source_fingerprint) {
+            close(fd);
+            info("ignoring stale pippenger point table at ", path);
+            return nullptr;
+        }
+
+        const auto file_size = static_cast<size_t>(st.st_size);
+        void* base = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+            return nullptr;
+        }
+
+        auto* table = reinterpret_cast<AffineElement*>(static_cast<char*>(base) + TABLE_OFFSET);
+        if (verify_checksum && compute_checksum(table, header.num_points) != header.checksum) {
+            munmap(base, file_size);
+            info("ignoring corrupted pippenger point table at ", path);
+            return nullptr;
+        }
+
+        return std::shared_ptr<AffineElement[]>(table, [base, file_size](AffineElement*) { munmap(base, file_size); });
+#endif
+    }
+
+    /**
+     * @brief Writes a point table of num_points SRS points (2 * num_points elements), read from the source files with
+     * the given fingerprint, to path
+     *
+     * @details The file is written under a temporary name, read back and checked against the checksum of the table
+     * and only then renamed, so readers never observe a partially or wrongly written table even if several provers
+     * populate the cache concurrently. Failures (e.g. a read only SRS directory) are not fatal, as the cache is an
+     * optimisation only.
+     *
+     * @return Whether the table was written
+     */
+    static bool write(std::string const& path,
+                      AffineElement const* table,
+                      size_t num_points,
+                      uint64_t source_fingerprint)
+    {
+#ifdef __wasm__
+        static_cast<void>(path);
+        static_cast<void>(table);
+        static_cast<void>(num_points);
+        static_cast<void>(source_fingerprint);
+        return false;
+#else
+        PointTableCacheHeader header{ .magic = MAGIC,
+                                      .version = VERSION,
+                                      .element_size = sizeof(AffineElement),
+                                      .curve_tag = Fq::modulus.data[0],
+                                      .num_points = num_points,
+                                      .checksum = compute_checksum(table, num_points),
+                                      .source_fingerprint = source_fingerprint };
+        std::array<char, TABLE_OFFSET> header_buffer{};
+        std::memcpy(header_buffer.data(), &header, sizeof(header));
+
+        const std::string tmp_path = path + ".tmp." + std::to_string(getpid());
+        std::ofstream file(tmp_path, std::ofstream::binary | std::ofstream::trunc);
+        file.write(header_buffer.data(), static_cast<std::streamsize>(header_buffer.size()));
+        file.write(reinterpret_cast<char const*>(table), static_cast<std::streamsize>(get_table_size(num_points)));
+        file.close();
+
+        std::error_code ec;
+        if (!file || read(tmp_path, num_points, source_fingerprint) == nullptr) {
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+        std::filesystem::rename(tmp_path, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+        return true;
+#endif
+    }
+};
+
+} // namespace bb::srs
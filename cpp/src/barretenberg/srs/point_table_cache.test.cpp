@@ -0,0 +1,171 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+template <typename Curve> class PointTableCacheTest : public ::testing::Test {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Cache = srs::PointTableCache<Curve>;
+
+    static constexpr size_t num_points = 1 << 10;
+    static constexpr uint64_t source_fingerprint = 0x1234;
+
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() / ("point_table_cache_test_" + std::to_string(getpid()));
+        std::filesystem::create_directories(dir);
+        path = Cache::get_path(dir.string());
+
+        table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+        std::generate_n(table.get(), num_points, [] { return AffineElement::random_element(&engine); });
+        scalar_multiplication::generate_pippenger_point_table<Curve>(table.get(), table.get(), num_points);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    std::filesystem::path dir;
+    std::string path;
+    std::shared_ptr<AffineElement[]> table;
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+} // namespace
+
+TYPED_TEST_SUITE(PointTableCacheTest, Curves);
+
+TYPED_TEST(PointTableCacheTest, WriteThenRead)
+{
+    using Cache = typename TestFixture::Cache;
+    constexpr size_t num_points = TestFixture::num_points;
+
+    constexpr uint64_t source_fingerprint = TestFixture::source_fingerprint;
+
+    EXPECT_TRUE(Cache::write(this->path, this->table.get(), num_points, source_fingerprint));
+
+    // A smaller degree is served by a prefix of the cached table
+    for (size_t degree : { num_points, num_points / 2 }) {
+        auto mapped = Cache::read(this->path, degree, source_fingerprint);
+        ASSERT_NE(mapped, nullptr);
+        EXPECT_EQ(memcmp(mapped.get(), this->table.get(), 2 * degree * sizeof(typename TestFixture::AffineElement)),
+                  0);
+    }
+}
+
+TYPED_TEST(PointTableCacheTest, RejectsMissingTooSmallStaleAndCorruptedTables)
+{
+    using Cache = typename TestFixture::Cache;
+    constexpr size_t num_points = TestFixture::num_points;
+    constexpr uint64_t source_fingerprint = TestFixture::source_fingerprint;
+
+    EXPECT_EQ(Cache::read(this->path, num_points, source_fingerprint), nullptr);
+
+    EXPECT_TRUE(Cache::write(this->path, this->table.get(), num_points, source_fingerprint));
+    EXPECT_EQ(Cache::read(this->path, num_points + 1, source_fingerprint), nullptr);
+    EXPECT_EQ(Cache::read(this->path, num_points, source_fingerprint + 1), nullptr);
+
+    // Flip a byte in the middle of the table data
+    {
+        std::fstream file(this->path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(std::filesystem::file_size(this->path) / 2));
+        char byte = 0;
+        file.read(&byte, 1);
+        byte = static_cast<char>(byte ^ 1);
+        file.seekp(static_cast<std::streamoff>(std::filesystem::file_size(this->path) / 2));
+        file.write(&byte, 1);
+    }
+    EXPECT_EQ(Cache::read(this->path, num_points, source_fingerprint), nullptr);
+    EXPECT_NE(Cache::read(this->path, num_points, source_fingerprint, /*verify_checksum=*/false), nullptr);
+
+    // A truncated table is rejected from its size alone
+    std::filesystem::resize_file(this->path, std::filesystem::file_size(this->path) - 1);
+    EXPECT_EQ(Cache::read(this->path, num_points, source_fingerprint, /*verify_checksum=*/false), nullptr);
+}
+
+TEST(PointTableCache, CurvesAreNotInterchangeable)
+{
+    using BN254Cache = srs::PointTableCache<curve::BN254>;
+    using GrumpkinCache = srs::PointTableCache<curve::Grumpkin>;
+    constexpr size_t num_points = 16;
+
+    auto dir = std::filesystem::temp_directory_path() / ("point_table_cache_test_curves_" + std::to_string(getpid()));
+    std::filesystem::create_directories(dir);
+    auto path = BN254Cache::get_path(dir.string());
+
+    auto table = scalar_multiplication::point_table_alloc<curve::BN254::AffineElement>(num_points);
+    std::generate_n(table.get(), num_points, [] { return curve::BN254::AffineElement::random_element(&engine); });
+    scalar_multiplication::generate_pippenger_point_table<curve::BN254>(table.get(), table.get(), num_points);
+
+    EXPECT_TRUE(BN254Cache::write(path, table.get(), num_points, 0));
+    EXPECT_NE(BN254Cache::read(path, num_points, 0), nullptr);
+    EXPECT_EQ(GrumpkinCache::read(path, num_points, 0), nullptr);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PointTableCache, SourceFingerprintTracksFileChanges)
+{
+    using Cache = srs::PointTableCache<curve::BN254>;
+
+    auto dir = std::filesystem::temp_directory_path() / ("point_table_cache_test_source_" + std::to_string(getpid()));
+    std::filesystem::create_directories(dir);
+    const std::string source_path = (dir / "points.dat").string();
+
+    const uint64_t missing = Cache::compute_source_fingerprint({ source_path });
+    std::ofstream(source_path) << "points";
+    const uint64_t written = Cache::compute_source_fingerprint({ source_path });
+    std::ofstream(source_path, std::ios::app) << "more points";
+    const uint64_t extended = Cache::compute_source_fingerprint({ source_path });
+
+    EXPECT_NE(missing, written);
+    EXPECT_NE(written, extended);
+    EXPECT_EQ(extended, Cache::compute_source_fingerprint({ source_path }));
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(PointTableCache, GlobalCrsBuildsTableOnceThenMapsIt)
+{
+    constexpr size_t num_points = 16;
+
+    auto dir = std::filesystem::temp_directory_path() / ("point_table_cache_test_global_" + std::to_string(getpid()));
+    std::filesystem::create_directories(dir);
+    const std::string points_path = (dir / "g1.dat").string();
+    std::ofstream(points_path) << "points";
+
+    std::vector<g1::affine_element> points(num_points);
+    std::generate(points.begin(), points.end(), [] { return g1::affine_element::random_element(&engine); });
+    size_t num_loads = 0;
+    auto get_points = [&] {
+        ++num_loads;
+        return points;
+    };
+
+    std::vector<g1::affine_element> tables[2];
+    for (auto& table : tables) {
+        srs::init_crs_factory(dir.string(), points_path, num_points, get_points, g2::affine_one);
+        auto crs = srs::get_bn254_crs_factory()->get_prover_crs(num_points);
+        EXPECT_EQ(crs->get_monomial_size(), num_points);
+        table.assign(crs->get_monomial_points(), crs->get_monomial_points() + 2 * num_points);
+    }
+    EXPECT_EQ(num_loads, 1);
+    EXPECT_EQ(tables[0], tables[1]);
+    EXPECT_EQ(tables[0][0], points[0]);
+
+    // Changing the points file invalidates the cached table
+    std::ofstream(points_path, std::ios::app) << "more points";
+    srs::init_crs_factory(dir.string(), points_path, num_points, get_points, g2::affine_one);
+    EXPECT_EQ(num_loads, 2);
+
+    std::filesystem::remove_all(dir);
+}
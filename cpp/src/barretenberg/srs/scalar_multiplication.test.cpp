@@ -18,6 +18,7 @@
 #include "barretenberg/srs/io.hpp"
 
 #include <cstddef>
+#include <limits>
 #include <vector>
 
 using namespace bb;
@@ -959,6 +960,100 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    // More than fit in a single group of the batch
+    constexpr size_t num_msms = 10;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    std::generate_n(points.get(), num_points, [] { return AffineElement(Element::random_element()); });
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    std::vector<std::vector<Fr>> scalar_vectors(num_msms, std::vector<Fr>(num_points));
+    std::vector<Fr*> scalars;
+    for (auto& scalar_vector : scalar_vectors) {
+        for (auto& scalar : scalar_vector) {
+            scalar = Fr::random_element();
+        }
+        scalars.push_back(scalar_vector.data());
+    }
+    // Include some structured scalars
+    std::fill(scalar_vectors[1].begin(), scalar_vectors[1].end(), Fr::zero());
+    scalar_vectors[2][0] = Fr::one();
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    std::vector<Element> expected;
+    for (auto* scalar_vector : scalars) {
+        expected.push_back(
+            scalar_multiplication::pippenger_unsafe<Curve>(scalar_vector, points.get(), num_points, state));
+    }
+
+    auto results = scalar_multiplication::pippenger_unsafe_batch<Curve>(scalars, points.get(), num_points, state);
+
+    ASSERT_EQ(results.size(), num_msms);
+    for (size_t i = 0; i < num_msms; ++i) {
+        EXPECT_EQ(results[i].normalize(), expected[i].normalize());
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeSparse)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    std::generate_n(points.get(), num_points, [] { return AffineElement(Element::random_element()); });
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    std::vector<Fr> scalars(num_points);
+    std::generate(scalars.begin(), scalars.end(), [] { return Fr::random_element(); });
+    EXPECT_FALSE(scalar_multiplication::has_many_small_scalars<Curve>(scalars.data(), num_points));
+
+    // Zeros, ones, small values and full size values
+    for (size_t i = 0; i < num_points; ++i) {
+        switch (i % 4) {
+        case 0:
+            scalars[i] = Fr::zero();
+            break;
+        case 1:
+            scalars[i] = Fr::one();
+            break;
+        case 2:
+            scalars[i] = Fr(engine.get_random_uint32() & ((1U << scalar_multiplication::SMALL_SCALAR_BITS) - 1));
+            break;
+        default:
+            break;
+        }
+    }
+    EXPECT_TRUE(scalar_multiplication::has_many_small_scalars<Curve>(scalars.data(), num_points));
+
+    Element expected =
+        scalar_multiplication::pippenger_unsafe<Curve>(scalars.data(), points.get(), num_points, state).normalize();
+    Element result =
+        scalar_multiplication::pippenger_unsafe_sparse<Curve>(scalars.data(), points.get(), num_points, state);
+    EXPECT_EQ(result.normalize(), expected);
+
+    // Only small values
+    for (size_t i = 3; i < num_points; i += 4) {
+        scalars[i] = Fr(i >> 3);
+    }
+    expected =
+        scalar_multiplication::pippenger_unsafe<Curve>(scalars.data(), points.get(), num_points, state).normalize();
+    result = scalar_multiplication::pippenger_unsafe_sparse<Curve>(scalars.data(), points.get(), num_points, state);
+    EXPECT_EQ(result.normalize(), expected);
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
@@ -1040,3 +1135,42 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, RuntimeStatePool)
+{
+    using Curve = TypeParam;
+    using State = scalar_multiplication::pippenger_runtime_state<Curve>;
+
+    scalar_multiplication::clear_pippenger_runtime_state_pool();
+    const size_t initial_usage = scalar_multiplication::get_pippenger_runtime_state_memory_usage();
+    const size_t state_size = State::get_memory_size(1024);
+
+    // A released state is reused, also for requests of a smaller size class
+    const State* first_state = scalar_multiplication::get_pippenger_runtime_state<Curve>(1000).get();
+    EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state<Curve>(1000).get(), first_state);
+    EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state<Curve>(600).get(), first_state);
+    EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state<Curve>(300).get(), first_state);
+    EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state<Curve>(1024).get(), first_state);
+    EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state_memory_usage(), initial_usage + state_size);
+
+    // States in use are never taken away, but idle ones beyond the limit are freed
+    scalar_multiplication::set_pippenger_runtime_state_memory_limit(initial_usage + state_size);
+    {
+        auto state_1 = scalar_multiplication::get_pippenger_runtime_state<Curve>(1024);
+        auto state_2 = scalar_multiplication::get_pippenger_runtime_state<Curve>(1024);
+        EXPECT_NE(state_1.get(), state_2.get());
+        EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state_memory_usage(), initial_usage + 2 * state_size);
+    }
+    EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state_memory_usage(), initial_usage + state_size);
+
+    // Making room for a larger state evicts the idle one
+    {
+        auto state = scalar_multiplication::get_pippenger_runtime_state<Curve>(4096);
+        EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state_memory_usage(),
+                  initial_usage + State::get_memory_size(4096));
+    }
+
+    scalar_multiplication::set_pippenger_runtime_state_memory_limit(std::numeric_limits<size_t>::max());
+    scalar_multiplication::clear_pippenger_runtime_state_pool();
+    EXPECT_EQ(scalar_multiplication::get_pippenger_runtime_state_memory_usage(), initial_usage);
+}
@@ -43,12 +43,9 @@ TYPED_TEST(PartialEvaluationTests, TwoRoundsSpecial)
 {
     using Flavor = TypeParam;
     using FF = typename Flavor::FF;
-    using Transcript = typename Flavor::Transcript;
+    using Round = SumcheckProverRound<Flavor>;
 
     // values here are chosen to check another test
-    const size_t multivariate_d(2);
-    const size_t multivariate_n(1 << multivariate_d);
-
     FF v00 = 0;
     FF v10 = 1;
     FF v01 = 0;
@@ -56,36 +53,27 @@ TYPED_TEST(PartialEvaluationTests, TwoRoundsSpecial)
 
     std::array<FF, 4> f0 = { v00, v10, v01, v11 };
 
-    auto full_polynomials = std::array<std::span<FF>, 1>({ f0 });
-    auto transcript = Transcript::prover_init_empty();
-    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
-
     FF round_challenge_0 = { 0x6c7301b49d85a46c, 0x44311531e39c64f6, 0xb13d66d8d6c1a24c, 0x04410c360230a295 };
     round_challenge_0.self_to_montgomery_form();
     FF expected_lo = v00 * (FF(1) - round_challenge_0) + v10 * round_challenge_0;
     FF expected_hi = v01 * (FF(1) - round_challenge_0) + v11 * round_challenge_0;
 
-    sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge_0);
-
-    auto& first_polynomial = sumcheck.partially_evaluated_polynomials.get_all()[0];
-    EXPECT_EQ(first_polynomial[0], round_challenge_0);
-    EXPECT_EQ(first_polynomial[1], FF(0));
+    const std::array challenges_0{ round_challenge_0 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_0), round_challenge_0);
+    EXPECT_EQ(Round::fold_row(f0, 1, challenges_0), FF(0));
 
     FF round_challenge_1 = 2;
     FF expected_val = expected_lo * (FF(1) - round_challenge_1) + expected_hi * round_challenge_1;
 
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 1, round_challenge_1);
-    EXPECT_EQ(first_polynomial[0], expected_val);
+    const std::array challenges_1{ round_challenge_0, round_challenge_1 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_1), expected_val);
 }
 
 TYPED_TEST(PartialEvaluationTests, TwoRoundsGeneric)
 {
     using Flavor = TypeParam;
     using FF = typename Flavor::FF;
-    using Transcript = typename Flavor::Transcript;
-
-    const size_t multivariate_d(2);
-    const size_t multivariate_n(1 << multivariate_d);
+    using Round = SumcheckProverRound<Flavor>;
 
     FF v00 = FF::random_element();
     FF v10 = FF::random_element();
@@ -94,24 +82,18 @@ TYPED_TEST(PartialEvaluationTests, TwoRoundsGeneric)
 
     std::array<FF, 4> f0 = { v00, v10, v01, v11 };
 
-    auto full_polynomials = std::array<std::span<FF>, 1>({ f0 });
-    auto transcript = Transcript::prover_init_empty();
-    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
-
     FF round_challenge_0 = FF::random_element();
     FF expected_lo = v00 * (FF(1) - round_challenge_0) + v10 * round_challenge_0;
     FF expected_hi = v01 * (FF(1) - round_challenge_0) + v11 * round_challenge_0;
 
-    sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge_0);
-    auto& first_polynomial = sumcheck.partially_evaluated_polynomials.get_all()[0];
-
-    EXPECT_EQ(first_polynomial[0], expected_lo);
-    EXPECT_EQ(first_polynomial[1], expected_hi);
+    const std::array challenges_0{ round_challenge_0 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_0), expected_lo);
+    EXPECT_EQ(Round::fold_row(f0, 1, challenges_0), expected_hi);
 
     FF round_challenge_1 = FF::random_element();
     FF expected_val = expected_lo * (FF(1) - round_challenge_1) + expected_hi * round_challenge_1;
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 1, round_challenge_1);
-    EXPECT_EQ(first_polynomial[0], expected_val);
+    const std::array challenges_1{ round_challenge_0, round_challenge_1 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_1), expected_val);
 }
 
 /*
@@ -140,10 +122,7 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsSpecial)
 {
     using Flavor = TypeParam;
     using FF = typename Flavor::FF;
-    using Transcript = typename Flavor::Transcript;
-
-    const size_t multivariate_d(3);
-    const size_t multivariate_n(1 << multivariate_d);
+    using Round = SumcheckProverRound<Flavor>;
 
     FF v000 = 1;
     FF v100 = 2;
@@ -156,46 +135,37 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsSpecial)
 
     std::array<FF, 8> f0 = { v000, v100, v010, v110, v001, v101, v011, v111 };
 
-    auto full_polynomials = std::array<std::span<FF>, 1>({ f0 });
-    auto transcript = Transcript::prover_init_empty();
-    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
-
     FF round_challenge_0 = 1;
     FF expected_q1 = v000 * (FF(1) - round_challenge_0) + v100 * round_challenge_0; // 2
     FF expected_q2 = v010 * (FF(1) - round_challenge_0) + v110 * round_challenge_0; // 4
     FF expected_q3 = v001 * (FF(1) - round_challenge_0) + v101 * round_challenge_0; // 6
     FF expected_q4 = v011 * (FF(1) - round_challenge_0) + v111 * round_challenge_0; // 8
 
-    sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge_0);
-
-    auto& first_polynomial = sumcheck.partially_evaluated_polynomials.get_all()[0];
-    EXPECT_EQ(first_polynomial[0], expected_q1);
-    EXPECT_EQ(first_polynomial[1], expected_q2);
-    EXPECT_EQ(first_polynomial[2], expected_q3);
-    EXPECT_EQ(first_polynomial[3], expected_q4);
+    const std::array challenges_0{ round_challenge_0 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_0), expected_q1);
+    EXPECT_EQ(Round::fold_row(f0, 1, challenges_0), expected_q2);
+    EXPECT_EQ(Round::fold_row(f0, 2, challenges_0), expected_q3);
+    EXPECT_EQ(Round::fold_row(f0, 3, challenges_0), expected_q4);
 
     FF round_challenge_1 = 2;
     FF expected_lo = expected_q1 * (FF(1) - round_challenge_1) + expected_q2 * round_challenge_1; // 6
     FF expected_hi = expected_q3 * (FF(1) - round_challenge_1) + expected_q4 * round_challenge_1; // 10
 
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 1, round_challenge_1);
-    EXPECT_EQ(first_polynomial[0], expected_lo);
-    EXPECT_EQ(first_polynomial[1], expected_hi);
+    const std::array challenges_1{ round_challenge_0, round_challenge_1 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_1), expected_lo);
+    EXPECT_EQ(Round::fold_row(f0, 1, challenges_1), expected_hi);
 
     FF round_challenge_2 = 3;
     FF expected_val = expected_lo * (FF(1) - round_challenge_2) + expected_hi * round_challenge_2; // 18
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 2, round_challenge_2);
-    EXPECT_EQ(first_polynomial[0], expected_val);
+    const std::array challenges_2{ round_challenge_0, round_challenge_1, round_challenge_2 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_2), expected_val);
 }
 
 TYPED_TEST(PartialEvaluationTests, ThreeRoundsGeneric)
 {
     using Flavor = TypeParam;
     using FF = typename Flavor::FF;
-    using Transcript = typename Flavor::Transcript;
-
-    const size_t multivariate_d(3);
-    const size_t multivariate_n(1 << multivariate_d);
+    using Round = SumcheckProverRound<Flavor>;
 
     FF v000 = FF::random_element();
     FF v100 = FF::random_element();
@@ -208,46 +178,38 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsGeneric)
 
     std::array<FF, 8> f0 = { v000, v100, v010, v110, v001, v101, v011, v111 };
 
-    auto full_polynomials = std::array<std::span<FF>, 1>({ f0 });
-    auto transcript = Transcript::prover_init_empty();
-    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
-
     FF round_challenge_0 = FF::random_element();
     FF expected_q1 = v000 * (FF(1) - round_challenge_0) + v100 * round_challenge_0;
     FF expected_q2 = v010 * (FF(1) - round_challenge_0) + v110 * round_challenge_0;
     FF expected_q3 = v001 * (FF(1) - round_challenge_0) + v101 * round_challenge_0;
     FF expected_q4 = v011 * (FF(1) - round_challenge_0) + v111 * round_challenge_0;
 
-    auto& first_polynomial = sumcheck.partially_evaluated_polynomials.get_all()[0];
-    sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge_0);
-
-    EXPECT_EQ(first_polynomial[0], expected_q1);
-    EXPECT_EQ(first_polynomial[1], expected_q2);
-    EXPECT_EQ(first_polynomial[2], expected_q3);
-    EXPECT_EQ(first_polynomial[3], expected_q4);
+    const std::array challenges_0{ round_challenge_0 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_0), expected_q1);
+    EXPECT_EQ(Round::fold_row(f0, 1, challenges_0), expected_q2);
+    EXPECT_EQ(Round::fold_row(f0, 2, challenges_0), expected_q3);
+    EXPECT_EQ(Round::fold_row(f0, 3, challenges_0), expected_q4);
 
     FF round_challenge_1 = FF::random_element();
     FF expected_lo = expected_q1 * (FF(1) - round_challenge_1) + expected_q2 * round_challenge_1;
     FF expected_hi = expected_q3 * (FF(1) - round_challenge_1) + expected_q4 * round_challenge_1;
 
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 1, round_challenge_1);
-    EXPECT_EQ(first_polynomial[0], expected_lo);
-    EXPECT_EQ(first_polynomial[1], expected_hi);
+    const std::array challenges_1{ round_challenge_0, round_challenge_1 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_1), expected_lo);
+    EXPECT_EQ(Round::fold_row(f0, 1, challenges_1), expected_hi);
 
     FF round_challenge_2 = FF::random_element();
     FF expected_val = expected_lo * (FF(1) - round_challenge_2) + expected_hi * round_challenge_2;
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 2, round_challenge_2);
-    EXPECT_EQ(first_polynomial[0], expected_val);
+    const std::array challenges_2{ round_challenge_0, round_challenge_1, round_challenge_2 };
+    EXPECT_EQ(Round::fold_row(f0, 0, challenges_2), expected_val);
 }
 
 TYPED_TEST(PartialEvaluationTests, ThreeRoundsGenericMultiplePolys)
 {
     using Flavor = TypeParam;
     using FF = typename Flavor::FF;
-    using Transcript = typename Flavor::Transcript;
+    using Round = SumcheckProverRound<Flavor>;
 
-    const size_t multivariate_d(3);
-    const size_t multivariate_n(1 << multivariate_d);
     std::array<FF, 3> v000;
     std::array<FF, 3> v100;
     std::array<FF, 3> v010;
@@ -271,9 +233,7 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsGenericMultiplePolys)
     std::array<FF, 8> f1 = { v000[1], v100[1], v010[1], v110[1], v001[1], v101[1], v011[1], v111[1] };
     std::array<FF, 8> f2 = { v000[2], v100[2], v010[2], v110[2], v001[2], v101[2], v011[2], v111[2] };
 
-    auto full_polynomials = std::array<std::span<FF>, 3>{ f0, f1, f2 };
-    auto transcript = Transcript::prover_init_empty();
-    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+    const std::array full_polynomials{ f0, f1, f2 };
 
     std::array<FF, 3> expected_q1;
     std::array<FF, 3> expected_q2;
@@ -287,13 +247,12 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsGenericMultiplePolys)
         expected_q4[i] = v011[i] * (FF(1) - round_challenge_0) + v111[i] * round_challenge_0;
     }
 
-    sumcheck.partially_evaluate(full_polynomials, multivariate_n, round_challenge_0);
-    auto polynomial_get_all = sumcheck.partially_evaluated_polynomials.get_all();
+    const std::array challenges_0{ round_challenge_0 };
     for (size_t i = 0; i < 3; i++) {
-        EXPECT_EQ((polynomial_get_all[i])[0], expected_q1[i]);
-        EXPECT_EQ((polynomial_get_all[i])[1], expected_q2[i]);
-        EXPECT_EQ((polynomial_get_all[i])[2], expected_q3[i]);
-        EXPECT_EQ((polynomial_get_all[i])[3], expected_q4[i]);
+        EXPECT_EQ(Round::fold_row(full_polynomials[i], 0, challenges_0), expected_q1[i]);
+        EXPECT_EQ(Round::fold_row(full_polynomials[i], 1, challenges_0), expected_q2[i]);
+        EXPECT_EQ(Round::fold_row(full_polynomials[i], 2, challenges_0), expected_q3[i]);
+        EXPECT_EQ(Round::fold_row(full_polynomials[i], 3, challenges_0), expected_q4[i]);
     }
 
     FF round_challenge_1 = FF::random_element();
@@ -303,18 +262,18 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsGenericMultiplePolys)
         expected_lo[i] = expected_q1[i] * (FF(1) - round_challenge_1) + expected_q2[i] * round_challenge_1;
         expected_hi[i] = expected_q3[i] * (FF(1) - round_challenge_1) + expected_q4[i] * round_challenge_1;
     }
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 1, round_challenge_1);
+    const std::array challenges_1{ round_challenge_0, round_challenge_1 };
     for (size_t i = 0; i < 3; i++) {
-        EXPECT_EQ((polynomial_get_all[i])[0], expected_lo[i]);
-        EXPECT_EQ((polynomial_get_all[i])[1], expected_hi[i]);
+        EXPECT_EQ(Round::fold_row(full_polynomials[i], 0, challenges_1), expected_lo[i]);
+        EXPECT_EQ(Round::fold_row(full_polynomials[i], 1, challenges_1), expected_hi[i]);
     }
     FF round_challenge_2 = FF::random_element();
     std::array<FF, 3> expected_val;
     for (size_t i = 0; i < 3; i++) {
         expected_val[i] = expected_lo[i] * (FF(1) - round_challenge_2) + expected_hi[i] * round_challenge_2;
     }
-    sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, multivariate_n >> 2, round_challenge_2);
+    const std::array challenges_2{ round_challenge_0, round_challenge_1, round_challenge_2 };
     for (size_t i = 0; i < 3; i++) {
-        EXPECT_EQ((polynomial_get_all[i])[0], expected_val[i]);
+        EXPECT_EQ(Round::fold_row(full_polynomials[i], 0, challenges_2), expected_val[i]);
     }
 }
@@ -33,7 +33,9 @@ template <typename Flavor> class SumcheckProver {
     * After the first round, the array will be updated (partially evaluated), so that the first n/2 rows will represent
     the
     * evaluations P_i(u0, X1, ..., X_{d-1}) as a low-degree extension on H^{d-1}. In reality, we elude copying all
-    * of the polynomial-defining data by only populating partially_evaluated_polynomials after the first round. I.e.:
+    * of the polynomial-defining data by only populating partially_evaluated_polynomials in the third round, with the
+    * n/4 rows of P_i(u0, u1, X2, ..., X_{d-1}). The first two rounds fold the full polynomials on the fly, reading the
+    * shifted polynomials through their unshifted parents. I.e.:
 
         We imagine all of the defining polynomial data in a matrix like this:
                     | P_1 | P_2 | P_3 | P_4 | ... | P_N | N = number of multivariatesk
@@ -57,13 +59,16 @@ template <typename Flavor> class SumcheckProver {
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
+    // Receives the folded polynomials of every other round from the fourth one on, as a round can not fold its input
+    // in place while other threads still read it. Holds n/8 values per polynomial.
+    PartiallyEvaluatedMultivariates folding_buffer;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , round(multivariate_n){};
 
     /**
      * @brief Compute univariate restriction place in transcript, generate challenge, partially evaluate,... repeat
@@ -94,29 +99,68 @@ template <typename Flavor> class SumcheckProver {
         multivariate_challenge.reserve(multivariate_d);
 
         // First round
-        // This populates partially_evaluated_polynomials.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
-        round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
-        // We operate on partially_evaluated_polynomials in place.
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        round.round_size = round.round_size >> 1;
+
+        // Second round: The full polynomials are folded at the first challenge on the fly, without storing the result
+        if (multivariate_d > 1) {
+            round_univariate = round.compute_folded_univariate(
+                full_polynomials, std::array{ round_challenge }, relation_parameters, pow_univariate, alpha);
+            transcript->send_to_verifier("Sumcheck:univariate_1", round_univariate);
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_1");
+            multivariate_challenge.emplace_back(round_challenge);
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
+
+        // All but final round
+        // Each round folds the previous round's polynomials at its challenge while computing its univariate. The
+        // third round folds the full polynomials at the first two challenges into partially_evaluated_polynomials,
+        // later rounds alternate between that and folding_buffer.
+        partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(std::max(multivariate_n / 2, size_t(2)));
+        if (multivariate_d > 3) {
+            folding_buffer = PartiallyEvaluatedMultivariates(multivariate_n / 4);
+        }
+        PartiallyEvaluatedMultivariates* folded = &partially_evaluated_polynomials;
+        PartiallyEvaluatedMultivariates* next_folded = &folding_buffer;
+        for (size_t round_idx = 2; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
-            round_univariate =
-                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
+            if (round_idx == 2) {
+                const std::array challenges{ multivariate_challenge[0], round_challenge };
+                round_univariate = round.compute_folded_univariate(
+                    full_polynomials, *folded, challenges, relation_parameters, pow_univariate, alpha);
+            } else {
+                round_univariate = round.compute_folded_univariate(
+                    *folded, *next_folded, std::array{ round_challenge }, relation_parameters, pow_univariate, alpha);
+                std::swap(folded, next_folded);
+            }
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
-            partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
         }
 
-        // Final round: Extract multivariate evaluations from partially_evaluated_polynomials and add to transcript
+        // Final round: Fold the polynomials of the last round at its challenge, leaving the multivariate evaluations
+        // in partially_evaluated_polynomials, and add them to transcript
+        auto evaluations = partially_evaluated_polynomials.get_all();
+        if (multivariate_d == 1) {
+            for (auto [evaluation, poly] : zip_view(evaluations, full_polynomials.get_all())) {
+                evaluation[0] = round.fold_row(poly, 0, std::array{ round_challenge });
+            }
+        } else if (multivariate_d == 2) {
+            for (auto [evaluation, poly] : zip_view(evaluations, full_polynomials.get_all())) {
+                evaluation[0] = round.fold_row(poly, 0, std::array{ multivariate_challenge[0], round_challenge });
+            }
+        } else {
+            for (auto [evaluation, poly] : zip_view(evaluations, folded->get_all())) {
+                evaluation[0] = round.fold_row(poly, 0, std::array{ round_challenge });
+            }
+        }
         ClaimedEvaluations multivariate_evaluations;
         for (auto [eval, poly] :
              zip_view(multivariate_evaluations.get_all(), partially_evaluated_polynomials.get_all())) {
@@ -126,48 +170,6 @@ template <typename Flavor> class SumcheckProver {
 
         return { multivariate_challenge, multivariate_evaluations };
     };
-
-    /**
-     * @brief Evaluate at the round challenge and prepare class for next round.
-     * Illustration of layout in example of first round when d==3 (showing just one Honk polynomial,
-     * i.e., what happens in just one column of our two-dimensional array):
-     *
-     * groups    vertex terms              collected vertex terms               groups after partial evaluation
-     *     g0 -- v0 (1-X0)(1-X1)(1-X2) --- (v0(1-X0) + v1 X0) (1-X1)(1-X2) ---- (v0(1-u0) + v1 u0) (1-X1)(1-X2)
-     *        \- v1   X0  (1-X1)(1-X2) --/                                  --- (v2(1-u0) + v3 u0)   X1  (1-X2)
-     *     g1 -- v2 (1-X0)  X1  (1-X2) --- (v2(1-X0) + v3 X0)   X1  (1-X2)-/ -- (v4(1-u0) + v5 u0) (1-X1)  X2
-     *        \- v3   X0    X1  (1-X2) --/                                  / - (v6(1-u0) + v7 u0)   X1    X2
-     *     g2 -- v4 (1-X0)(1-X1)  X2   --- (v4(1-X0) + v5 X0) (1-X1)  X2  -/ /
-     *        \- v5   X0  (1-X1)  X2   --/                                  /
-     *     g3 -- v6 (1-X0)  X1    X2   --- (v6(1-X0) + v7 X0)   X1    X2  -/
-     *        \- v7   X0    X1    X2   --/
-     */
-    void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
-    {
-        auto pep_view = partially_evaluated_polynomials.get_all();
-        auto poly_view = polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
-        parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
-            }
-        });
-    };
-    /**
-     * @brief Evaluate at the round challenge and prepare class for next round.
-     * Specialization for array, see generic version above.
-     */
-    template <typename PolynomialT, std::size_t N>
-    void partially_evaluate(std::array<PolynomialT, N>& polynomials, size_t round_size, FF round_challenge)
-    {
-        auto pep_view = partially_evaluated_polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
-        parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
-            }
-        });
-    };
 };
 
 template <typename Flavor> class SumcheckVerifier {
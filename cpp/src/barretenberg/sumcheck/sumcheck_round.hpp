@@ -65,6 +65,8 @@ template <typename Flavor> class SumcheckProverRound {
     static constexpr size_t NUM_RELATIONS = Flavor::NUM_RELATIONS;
     static constexpr size_t MAX_PARTIAL_RELATION_LENGTH = Flavor::MAX_PARTIAL_RELATION_LENGTH;
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
+    // The number of edges extended together, see extend_edge_block. Their extensions take up some 10-20 KB per edge.
+    static constexpr size_t EDGE_BLOCK_SIZE = 16;
 
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
 
@@ -77,20 +79,93 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
     /**
-     * @brief Extend each edge in the edge group at to max-relation-length-many values.
+     * @brief Extend a block of consecutive edges, starting at edge_idx, to max-relation-length-many values.
      *
-     * @details Should only be called externally with relation_idx equal to 0.
-     * In practice, multivariates is one of ProverPolynomials or FoldedPolynomials.
+     * @details The block is extended one multivariate at a time, so that each multivariate is read as one contiguous
+     * run of 2 * extended_edges.size() values, rather than reading two values of every multivariate per edge. The views
+     * are obtained once per thread by the caller, as building them is not free either.
      *
      */
-    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
-    void extend_edges(ExtendedEdges& extended_edges,
-                      const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
-                      size_t edge_idx)
+    template <typename MultivariatesView, typename ExtendedEdgesView>
+    static void extend_edge_block(std::span<ExtendedEdgesView> extended_edges,
+                                  const MultivariatesView& multivariates,
+                                  size_t edge_idx)
     {
-        for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-            extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+        for (size_t poly_idx = 0; poly_idx < multivariates.size(); ++poly_idx) {
+            const auto& multivariate = multivariates[poly_idx];
+            for (size_t i = 0; i < extended_edges.size(); ++i) {
+                bb::Univariate<FF, 2> edge({ multivariate[edge_idx + 2 * i], multivariate[edge_idx + 2 * i + 1] });
+                extended_edges[i][poly_idx] = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+            }
+        }
+    }
+
+    /**
+     * @brief Return row `row` of a multivariate partially evaluated at the given challenges, the first of which binds
+     * the lowest variable, computed from the 2^NUM_CHALLENGES rows it is folded from.
+     *
+     * @details Illustration of a single challenge u0 when d==3 (showing just one Honk polynomial, i.e., what happens
+     * in just one column of our two-dimensional array). Row i of the result is fold_row(multivariate, i, { u0 }):
+     *
+     * groups    vertex terms              collected vertex terms               groups after partial evaluation
+     *     g0 -- v0 (1-X0)(1-X1)(1-X2) --- (v0(1-X0) + v1 X0) (1-X1)(1-X2) ---- (v0(1-u0) + v1 u0) (1-X1)(1-X2)
+     *        \- v1   X0  (1-X1)(1-X2) --/                                  --- (v2(1-u0) + v3 u0)   X1  (1-X2)
+     *     g1 -- v2 (1-X0)  X1  (1-X2) --- (v2(1-X0) + v3 X0)   X1  (1-X2)-/ -- (v4(1-u0) + v5 u0) (1-X1)  X2
+     *        \- v3   X0    X1  (1-X2) --/                                  / - (v6(1-u0) + v7 u0)   X1    X2
+     *     g2 -- v4 (1-X0)(1-X1)  X2   --- (v4(1-X0) + v5 X0) (1-X1)  X2  -/ /
+     *        \- v5   X0  (1-X1)  X2   --/                                  /
+     *     g3 -- v6 (1-X0)  X1    X2   --- (v6(1-X0) + v7 X0)   X1    X2  -/
+     *        \- v7   X0    X1    X2   --/
+     */
+    template <size_t NUM_CHALLENGES, typename Multivariate>
+    static FF fold_row(const Multivariate& multivariate, size_t row, const std::array<FF, NUM_CHALLENGES>& challenges)
+    {
+        std::array<FF, size_t(1) << NUM_CHALLENGES> values;
+        for (size_t j = 0; j < values.size(); ++j) {
+            values[j] = multivariate[(row << NUM_CHALLENGES) + j];
+        }
+        size_t num_values = values.size();
+        for (const FF& challenge : challenges) {
+            num_values >>= 1;
+            for (size_t j = 0; j < num_values; ++j) {
+                values[j] = values[2 * j] + challenge * (values[2 * j + 1] - values[2 * j]);
+            }
+        }
+        return values[0];
+    }
+
+    /**
+     * @brief Fold the values of earlier rounds at their challenges, then extend a block of consecutive edges of the
+     * folded multivariates starting at edge_idx, as extend_edge_block does.
+     *
+     * @details Edge i of the block is folded from the rows of `multivariates` that rows edge_idx + 2i and
+     * edge_idx + 2i + 1 of the folded multivariates are made of, see fold_row, and extended straight from registers.
+     * Unless `folded_multivariates` is nullptr, the two folded values are also written to it, for the next round to
+     * read.
+     */
+    template <size_t NUM_CHALLENGES,
+              typename MultivariatesView,
+              typename FoldedMultivariatesView,
+              typename ExtendedEdgesView>
+    static void fold_and_extend_edge_block(std::span<ExtendedEdgesView> extended_edges,
+                                           const MultivariatesView& multivariates,
+                                           const FoldedMultivariatesView& folded_multivariates,
+                                           const std::array<FF, NUM_CHALLENGES>& challenges,
+                                           size_t edge_idx)
+    {
+        for (size_t poly_idx = 0; poly_idx < multivariates.size(); ++poly_idx) {
+            const auto& multivariate = multivariates[poly_idx];
+            for (size_t i = 0; i < extended_edges.size(); ++i) {
+                const size_t idx = edge_idx + 2 * i;
+                bb::Univariate<FF, 2> edge(
+                    { fold_row(multivariate, idx, challenges), fold_row(multivariate, idx + 1, challenges) });
+                if constexpr (!std::is_null_pointer_v<FoldedMultivariatesView>) {
+                    auto& folded = folded_multivariates[poly_idx];
+                    folded[idx] = edge.value_at(0);
+                    folded[idx + 1] = edge.value_at(1);
+                }
+                extended_edges[i][poly_idx] = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+            }
         }
     }
 
@@ -107,59 +182,73 @@ template <typename Flavor> class SumcheckProverRound {
         const RelationSeparator alpha)
     {
         BB_OP_COUNT_TIME();
+        return accumulate_edge_blocks(
+            [&]() {
+                return [multivariates = polynomials.get_all()](auto extended_edges, size_t edge_idx) {
+                    extend_edge_block(extended_edges, multivariates, edge_idx);
+                };
+            },
+            relation_parameters,
+            pow_polynomial,
+            alpha);
+    }
 
-        // Compute the constant contribution of pow polynomials for each edge. This is  the product of the partial
-        // evaluation result c_l (i.e. pow(u_0,...,u_{l-1})) where u_0,...,u_{l-1} are the verifier challenges from
-        // previous rounds) and the elements of pow(\vec{β}) not containing β_0,..., β_l.
-        std::vector<FF> pow_challenges(round_size >> 1);
-        pow_challenges[0] = pow_polynomial.partial_evaluation_result;
-        for (size_t i = 1; i < (round_size >> 1); ++i) {
-            pow_challenges[i] = pow_challenges[0] * pow_polynomial[i * pow_polynomial.periodicity];
-        }
-
-        // Determine number of threads for multithreading.
-        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
-        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
-
-        // Construct univariate accumulator containers; one per thread
-        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
-        for (auto& accum : thread_univariate_accumulators) {
-            Utils::zero_univariates(accum);
-        }
-
-        // Construct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
-
-        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the i-th edge's univariate contribution,
-                // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_challenges[edge_idx >> 1]);
-            }
-        });
-
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
-        }
+    /**
+     * @brief Partially evaluate `polynomials` at the challenges of the rounds since they were last folded, into
+     * `folded_polynomials`, and return the univariate of this round, computed from the folded values in the same sweep.
+     *
+     * @details Equivalent to partially evaluating `polynomials` (of size 2^NUM_CHALLENGES * round_size) at each
+     * challenge in turn and calling compute_univariate on the result, but each row of the result is extended while
+     * still in registers rather than read back in a second pass. Like compute_univariate, the rows are split between
+     * threads. The folded values of one thread are read by others, so `polynomials` and `folded_polynomials` must not
+     * share memory.
+     */
+    template <size_t NUM_CHALLENGES, typename Polynomials, typename FoldedPolynomials>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_folded_univariate(
+        Polynomials& polynomials,
+        FoldedPolynomials& folded_polynomials,
+        const std::array<FF, NUM_CHALLENGES>& challenges,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha)
+    {
+        BB_OP_COUNT_TIME();
+        return accumulate_edge_blocks(
+            [&]() {
+                return [multivariates = polynomials.get_all(),
+                        folded_multivariates = folded_polynomials.get_all(),
+                        &challenges](auto extended_edges, size_t edge_idx) {
+                    fold_and_extend_edge_block(
+                        extended_edges, multivariates, folded_multivariates, challenges, edge_idx);
+                };
+            },
+            relation_parameters,
+            pow_polynomial,
+            alpha);
+    }
 
-        // Batch the univariate contributions from each sub-relation to obtain the round univariate
-        return batch_over_relations<bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
-            univariate_accumulators, alpha, pow_polynomial);
+    /**
+     * @brief As above, but the folded values are only used to compute the univariate of this round and are not stored.
+     * The next round folds `polynomials` again, at one more challenge.
+     */
+    template <size_t NUM_CHALLENGES, typename Polynomials>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> compute_folded_univariate(
+        Polynomials& polynomials,
+        const std::array<FF, NUM_CHALLENGES>& challenges,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha)
+    {
+        BB_OP_COUNT_TIME();
+        return accumulate_edge_blocks(
+            [&]() {
+                return [multivariates = polynomials.get_all(), &challenges](auto extended_edges, size_t edge_idx) {
+                    fold_and_extend_edge_block(extended_edges, multivariates, nullptr, challenges, edge_idx);
+                };
+            },
+            relation_parameters,
+            pow_polynomial,
+            alpha);
     }
 
     /**
@@ -219,6 +308,79 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief Accumulate the contributions of every edge of the round into the round univariate, extending the edges a
+     * block at a time with the extender returned by `make_block_extender`, which is called once per thread.
+     */
+    template <typename MakeBlockExtender>
+    bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH> accumulate_edge_blocks(
+        const MakeBlockExtender& make_block_extender,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::PowPolynomial<FF>& pow_polynomial,
+        const RelationSeparator alpha)
+    {
+        // Compute the constant contribution of pow polynomials for each edge. This is  the product of the partial
+        // evaluation result c_l (i.e. pow(u_0,...,u_{l-1})) where u_0,...,u_{l-1} are the verifier challenges from
+        // previous rounds) and the elements of pow(\vec{β}) not containing β_0,..., β_l.
+        std::vector<FF> pow_challenges(round_size >> 1);
+        pow_challenges[0] = pow_polynomial.partial_evaluation_result;
+        for (size_t i = 1; i < (round_size >> 1); ++i) {
+            pow_challenges[i] = pow_challenges[0] * pow_polynomial[i * pow_polynomial.periodicity];
+        }
+
+        // Determine number of threads for multithreading.
+        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
+        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
+        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
+        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+
+        // Construct univariate accumulator containers; one per thread
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+        for (auto& accum : thread_univariate_accumulators) {
+            Utils::zero_univariates(accum);
+        }
+
+        // Construct extended edge containers; one block per thread
+        std::vector<std::array<ExtendedEdges, EDGE_BLOCK_SIZE>> extended_edges(num_threads);
+
+        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            size_t start = thread_idx * iterations_per_thread;
+            size_t end = (thread_idx + 1) * iterations_per_thread;
+
+            const auto extend_block = make_block_extender();
+            std::array<decltype(extended_edges[thread_idx][0].get_all()), EDGE_BLOCK_SIZE> extended_edge_views;
+            for (size_t i = 0; i < EDGE_BLOCK_SIZE; ++i) {
+                extended_edge_views[i] = extended_edges[thread_idx][i].get_all();
+            }
+
+            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2 * EDGE_BLOCK_SIZE) {
+                const size_t block_size = std::min(EDGE_BLOCK_SIZE, (end - edge_idx) / 2);
+                extend_block(std::span{ extended_edge_views.data(), block_size }, edge_idx);
+
+                // Compute each edge's univariate contribution,
+                // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
+                for (size_t i = 0; i < block_size; ++i) {
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx][i],
+                                                    relation_parameters,
+                                                    pow_challenges[(edge_idx >> 1) + i]);
+                }
+            }
+        });
+
+        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        return batch_over_relations<bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>>(
+            univariate_accumulators, alpha, pow_polynomial);
+    }
+
     /**
      * @brief For a given edge, calculate the contribution of each relation to the prover round univariate (S_l in the
      * thesis).
@@ -241,8 +403,11 @@ template <typename Flavor> class SumcheckProverRound {
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        // Relations whose selectors vanish on this edge contribute nothing, so we do not evaluate them
+        if (!relation_can_be_skipped<Relation>(extended_edges)) {
+            Relation::accumulate(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
@@ -131,3 +131,115 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Test that extending a block of edges agrees with extending each edge on its own
+ *
+ */
+TEST(SumcheckRound, ExtendEdgeBlock)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using ExtendedEdges = typename Flavor::ExtendedEdges;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using SumcheckRound = SumcheckProverRound<Flavor>;
+    constexpr size_t MAX_PARTIAL_RELATION_LENGTH = Flavor::MAX_PARTIAL_RELATION_LENGTH;
+    // Use a block that is smaller than EDGE_BLOCK_SIZE to check partial blocks as well
+    const size_t num_edges = SumcheckRound::EDGE_BLOCK_SIZE - 3;
+    const size_t start_idx = 4;
+
+    ProverPolynomials polynomials;
+    for (auto& polynomial : polynomials.get_all()) {
+        polynomial = Polynomial<FF>(start_idx + 2 * num_edges);
+        for (auto& coeff : polynomial) {
+            coeff = FF::random_element();
+        }
+    }
+
+    std::vector<ExtendedEdges> extended_edges(num_edges);
+    std::vector<decltype(extended_edges[0].get_all())> extended_edge_views;
+    for (auto& edges : extended_edges) {
+        extended_edge_views.emplace_back(edges.get_all());
+    }
+    SumcheckRound::extend_edge_block(std::span{ extended_edge_views }, polynomials.get_all(), start_idx);
+
+    for (size_t i = 0; i < num_edges; ++i) {
+        for (auto [extended_edge, polynomial] : zip_view(extended_edges[i].get_all(), polynomials.get_all())) {
+            size_t edge_idx = start_idx + 2 * i;
+            Univariate<FF, 2> edge({ polynomial[edge_idx], polynomial[edge_idx + 1] });
+            EXPECT_EQ(extended_edge, edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>());
+        }
+    }
+}
+
+/**
+ * @brief Test that folding and extending a block of edges agrees with partially evaluating the multivariates at each
+ * challenge and then extending the block
+ *
+ */
+TEST(SumcheckRound, FoldAndExtendEdgeBlock)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using ExtendedEdges = typename Flavor::ExtendedEdges;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using SumcheckRound = SumcheckProverRound<Flavor>;
+    const size_t num_edges = SumcheckRound::EDGE_BLOCK_SIZE - 3;
+    const size_t start_idx = 4;
+    const size_t folded_size = start_idx + 2 * num_edges;
+    const std::array<FF, 2> challenges{ FF::random_element(), FF::random_element() };
+
+    ProverPolynomials polynomials;
+    ProverPolynomials folded_polynomials;
+    ProverPolynomials expected_folded_polynomials;
+    for (auto [polynomial, folded, expected_folded] :
+         zip_view(polynomials.get_all(), folded_polynomials.get_all(), expected_folded_polynomials.get_all())) {
+        polynomial = Polynomial<FF>(4 * folded_size);
+        for (auto& coeff : polynomial) {
+            coeff = FF::random_element();
+        }
+        Polynomial<FF> half_folded(2 * folded_size);
+        for (size_t i = 0; i < 2 * folded_size; ++i) {
+            half_folded[i] = polynomial[2 * i] + challenges[0] * (polynomial[2 * i + 1] - polynomial[2 * i]);
+        }
+        folded = Polynomial<FF>(folded_size);
+        expected_folded = Polynomial<FF>(folded_size);
+        for (size_t i = 0; i < folded_size; ++i) {
+            expected_folded[i] = half_folded[2 * i] + challenges[1] * (half_folded[2 * i + 1] - half_folded[2 * i]);
+        }
+    }
+
+    std::vector<ExtendedEdges> extended_edges(num_edges);
+    std::vector<ExtendedEdges> unstored_extended_edges(num_edges);
+    std::vector<ExtendedEdges> expected_extended_edges(num_edges);
+    std::vector<decltype(extended_edges[0].get_all())> extended_edge_views;
+    std::vector<decltype(extended_edges[0].get_all())> unstored_extended_edge_views;
+    std::vector<decltype(extended_edges[0].get_all())> expected_extended_edge_views;
+    for (size_t i = 0; i < num_edges; ++i) {
+        extended_edge_views.emplace_back(extended_edges[i].get_all());
+        unstored_extended_edge_views.emplace_back(unstored_extended_edges[i].get_all());
+        expected_extended_edge_views.emplace_back(expected_extended_edges[i].get_all());
+    }
+    SumcheckRound::fold_and_extend_edge_block(
+        std::span{ extended_edge_views }, polynomials.get_all(), folded_polynomials.get_all(), challenges, start_idx);
+    SumcheckRound::fold_and_extend_edge_block(
+        std::span{ unstored_extended_edge_views }, polynomials.get_all(), nullptr, challenges, start_idx);
+    SumcheckRound::extend_edge_block(
+        std::span{ expected_extended_edge_views }, expected_folded_polynomials.get_all(), start_idx);
+
+    for (auto [folded, expected_folded] :
+         zip_view(folded_polynomials.get_all(), expected_folded_polynomials.get_all())) {
+        for (size_t i = start_idx; i < folded_size; ++i) {
+            EXPECT_EQ(folded[i], expected_folded[i]);
+        }
+    }
+    for (size_t i = 0; i < num_edges; ++i) {
+        for (auto [extended_edge, unstored_extended_edge, expected_extended_edge] :
+             zip_view(extended_edges[i].get_all(),
+                      unstored_extended_edges[i].get_all(),
+                      expected_extended_edges[i].get_all())) {
+            EXPECT_EQ(extended_edge, expected_extended_edge);
+            EXPECT_EQ(unstored_extended_edge, expected_extended_edge);
+        }
+    }
+}
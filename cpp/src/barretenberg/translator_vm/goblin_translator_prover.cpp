@@ -240,8 +240,13 @@ void GoblinTranslatorProver::execute_wire_and_sorted_constraints_commitments_rou
     // Commit to all wire polynomials
     auto wire_polys = key->get_wires();
     auto labels = commitment_labels.get_wires();
+    std::vector<std::span<const FF>> wires;
+    for (auto& wire : wire_polys) {
+        wires.emplace_back(wire);
+    }
+    auto wire_commitments = commitment_key->batch_commit(wires);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], wire_commitments[idx]);
     }
 }
 
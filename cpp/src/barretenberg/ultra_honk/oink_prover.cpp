@@ -1,4 +1,7 @@
 #include "barretenberg/ultra_honk/oink_prover.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <algorithm>
 
 namespace bb {
 
@@ -30,11 +33,28 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_preamble_round(
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitments_round()
 {
+    auto& key = instance->proving_key;
+
     // Commit to the first three wire polynomials of the instance
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(instance->proving_key->w_l);
-    witness_commitments.w_r = commitment_key->commit(instance->proving_key->w_r);
-    witness_commitments.w_o = commitment_key->commit(instance->proving_key->w_o);
+    std::vector<Task> tasks{
+        [&] { witness_commitments.w_l = commitment_key->commit(key->w_l); },
+        [&] { witness_commitments.w_r = commitment_key->commit(key->w_r); },
+        [&] { witness_commitments.w_o = commitment_key->commit(key->w_o); },
+    };
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        // Commit to Goblin ECC op wires
+        tasks.emplace_back([&] { witness_commitments.ecc_op_wire_1 = commitment_key->commit(key->ecc_op_wire_1); });
+        tasks.emplace_back([&] { witness_commitments.ecc_op_wire_2 = commitment_key->commit(key->ecc_op_wire_2); });
+        tasks.emplace_back([&] { witness_commitments.ecc_op_wire_3 = commitment_key->commit(key->ecc_op_wire_3); });
+        tasks.emplace_back([&] { witness_commitments.ecc_op_wire_4 = commitment_key->commit(key->ecc_op_wire_4); });
+        // Commit to DataBus columns
+        tasks.emplace_back([&] { witness_commitments.calldata = commitment_key->commit(key->calldata); });
+        tasks.emplace_back([&] {
+            witness_commitments.calldata_read_counts = commitment_key->commit(key->calldata_read_counts);
+        });
+    }
+    parallel_invoke(tasks, MAX_CONCURRENT_TASKS);
 
     auto wire_comms = witness_commitments.get_wires();
     auto wire_labels = commitment_labels.get_wires();
@@ -43,20 +63,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(instance->proving_key->ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(instance->proving_key->ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(instance->proving_key->ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(instance->proving_key->ecc_op_wire_4);
-
         auto op_wire_comms = witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
         for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
             transcript->send_to_verifier(domain_separator + labels[idx], op_wire_comms[idx]);
         }
-        // Commit to DataBus columns
-        witness_commitments.calldata = commitment_key->commit(instance->proving_key->calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(instance->proving_key->calldata_read_counts);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata, witness_commitments.calldata);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata_read_counts,
                                      witness_commitments.calldata_read_counts);
@@ -75,8 +86,12 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
 
     // Commit to the sorted witness-table accumulator and the finalized (i.e. with memory records) fourth wire
     // polynomial
-    witness_commitments.sorted_accum = commitment_key->commit(instance->proving_key->sorted_accum);
-    witness_commitments.w_4 = commitment_key->commit(instance->proving_key->w_4);
+    parallel_invoke(
+        {
+            [&] { witness_commitments.sorted_accum = commitment_key->commit(instance->proving_key->sorted_accum); },
+            [&] { witness_commitments.w_4 = commitment_key->commit(instance->proving_key->w_4); },
+        },
+        MAX_CONCURRENT_TASKS);
 
     transcript->send_to_verifier(domain_separator + commitment_labels.sorted_accum, witness_commitments.sorted_accum);
     transcript->send_to_verifier(domain_separator + commitment_labels.w_4, witness_commitments.w_4);
@@ -110,8 +125,12 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_c
     instance->compute_grand_product_polynomials(instance->relation_parameters.beta,
                                                 instance->relation_parameters.gamma);
 
-    witness_commitments.z_perm = commitment_key->commit(instance->proving_key->z_perm);
-    witness_commitments.z_lookup = commitment_key->commit(instance->proving_key->z_lookup);
+    parallel_invoke(
+        {
+            [&] { witness_commitments.z_perm = commitment_key->commit(instance->proving_key->z_perm); },
+            [&] { witness_commitments.z_lookup = commitment_key->commit(instance->proving_key->z_lookup); },
+        },
+        MAX_CONCURRENT_TASKS);
 
     transcript->send_to_verifier(domain_separator + commitment_labels.z_perm, witness_commitments.z_perm);
     transcript->send_to_verifier(domain_separator + commitment_labels.z_lookup, witness_commitments.z_lookup);
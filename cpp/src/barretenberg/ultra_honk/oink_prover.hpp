@@ -17,6 +17,7 @@
 *                        L\              L\
 */
 // clang-format on
+#include <functional>
 #include <utility>
 
 #include "barretenberg/flavor/goblin_ultra.hpp"
@@ -65,5 +66,16 @@ template <IsUltraFlavor Flavor> class OinkProver {
     void execute_sorted_list_accumulator_round();
     void execute_log_derivative_inverse_round();
     void execute_grand_product_computation_round();
+
+  private:
+    // A unit of work within a round, e.g. a commitment. The rounds are serialized by their Fiat-Shamir challenges, but
+    // the work within a round is largely independent, and a single MSM of a mid-sized circuit parallelizes poorly, so
+    // the tasks of a round are run concurrently with parallel_invoke. Tasks must not touch the transcript: all
+    // messages are sent afterwards, in the usual order.
+    using Task = std::function<void()>;
+
+    // Bounds the memory spent on pippenger scratch space when running tasks concurrently. Each task borrows scratch
+    // space from the process-wide pool, so with a single thread no more is in use than when committing sequentially.
+    static constexpr size_t MAX_CONCURRENT_TASKS = 4;
 };
 } // namespace bb
\ No newline at end of file